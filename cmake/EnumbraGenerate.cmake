@@ -0,0 +1,79 @@
+# enumbra_generate(<target>
+#     CONFIG <enumbra_config.json>
+#     SOURCES <enum.json>...
+#     [OUTPUT_DIR <dir>]
+#     [EXECUTABLE <enumbra>]
+# )
+#
+# Generates one header per schema, named after the schema (enum.json -> enum.hpp), into OUTPUT_DIR
+# (default: ${CMAKE_CURRENT_BINARY_DIR}/enumbra). Creates <target>, an INTERFACE library with OUTPUT_DIR as
+# include directory that depends on the generated headers, so targets linking it are built after generation.
+#
+# Each header is its own custom command. enumbra writes a depfile listing the config and schema the header
+# was generated from, so only the headers of changed schemas are regenerated. Headers whose content didn't
+# change keep their timestamp and don't trigger rebuilds of their includers. The command's output is a
+# stamp file with the header as byproduct, so generators without restat (Make) don't rerun enumbra for them.
+#
+# EXECUTABLE defaults to the enumbra target when enumbra is part of the build, otherwise to enumbra on the PATH.
+
+function(enumbra_generate TARGET)
+	cmake_parse_arguments(PARSE_ARGV 1 ENUMBRA "" "CONFIG;OUTPUT_DIR;EXECUTABLE" "SOURCES")
+	if(NOT ENUMBRA_CONFIG)
+		message(FATAL_ERROR "enumbra_generate(${TARGET}): CONFIG is required")
+	endif()
+	if(NOT ENUMBRA_SOURCES)
+		message(FATAL_ERROR "enumbra_generate(${TARGET}): SOURCES is required")
+	endif()
+	if(NOT ENUMBRA_OUTPUT_DIR)
+		set(ENUMBRA_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/enumbra")
+	endif()
+
+	set(ENUMBRA_DEPENDS "")
+	if(NOT ENUMBRA_EXECUTABLE)
+		if(TARGET enumbra)
+			set(ENUMBRA_EXECUTABLE "$<TARGET_FILE:enumbra>")
+			set(ENUMBRA_DEPENDS enumbra)
+		else()
+			find_program(ENUMBRA_PROGRAM enumbra REQUIRED)
+			set(ENUMBRA_EXECUTABLE "${ENUMBRA_PROGRAM}")
+		endif()
+	endif()
+
+	cmake_path(ABSOLUTE_PATH ENUMBRA_CONFIG BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" NORMALIZE)
+	cmake_path(ABSOLUTE_PATH ENUMBRA_OUTPUT_DIR BASE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}" NORMALIZE)
+	file(MAKE_DIRECTORY "${ENUMBRA_OUTPUT_DIR}")
+
+	set(ENUMBRA_OUTPUTS "")
+	set(ENUMBRA_STAMPS "")
+	foreach(ENUMBRA_SOURCE IN LISTS ENUMBRA_SOURCES)
+		cmake_path(ABSOLUTE_PATH ENUMBRA_SOURCE BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" NORMALIZE)
+		cmake_path(GET ENUMBRA_SOURCE STEM ENUMBRA_NAME)
+		set(ENUMBRA_OUTPUT "${ENUMBRA_OUTPUT_DIR}/${ENUMBRA_NAME}.hpp")
+		set(ENUMBRA_STAMP "${ENUMBRA_OUTPUT_DIR}/${ENUMBRA_NAME}.hpp.stamp")
+		if(ENUMBRA_OUTPUT IN_LIST ENUMBRA_OUTPUTS)
+			message(FATAL_ERROR "enumbra_generate(${TARGET}): several schemas would be generated to ${ENUMBRA_OUTPUT}")
+		endif()
+
+		add_custom_command(
+			OUTPUT "${ENUMBRA_STAMP}"
+			BYPRODUCTS "${ENUMBRA_OUTPUT}"
+			COMMAND "${ENUMBRA_EXECUTABLE}"
+				-c "${ENUMBRA_CONFIG}"
+				-s "${ENUMBRA_SOURCE}"
+				--cppout "${ENUMBRA_OUTPUT}"
+				--depfile "${ENUMBRA_OUTPUT}.d"
+				--stamp "${ENUMBRA_STAMP}"
+			DEPENDS "${ENUMBRA_CONFIG}" "${ENUMBRA_SOURCE}" ${ENUMBRA_DEPENDS}
+			DEPFILE "${ENUMBRA_OUTPUT}.d"
+			COMMENT "Generating ${ENUMBRA_NAME}.hpp with enumbra"
+			VERBATIM
+		)
+		list(APPEND ENUMBRA_OUTPUTS "${ENUMBRA_OUTPUT}")
+		list(APPEND ENUMBRA_STAMPS "${ENUMBRA_STAMP}")
+	endforeach()
+
+	add_custom_target(${TARGET}_generate DEPENDS ${ENUMBRA_STAMPS})
+	add_library(${TARGET} INTERFACE)
+	target_include_directories(${TARGET} INTERFACE "${ENUMBRA_OUTPUT_DIR}")
+	add_dependencies(${TARGET} ${TARGET}_generate)
+endfunction()
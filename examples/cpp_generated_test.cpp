@@ -0,0 +1,13 @@
+// Includes enum_minimal.hpp, which is generated into the build directory by enumbra_generate() in CMakeLists.txt
+// and found through the include directory of the enumbra_generated_enums target.
+#include "enum_minimal.hpp"
+
+static_assert(enumbra::to_string(enums::minimal_val::C).size == 1, "");
+static_assert(enumbra::from_string<enums::minimal_val>("B").value() == enums::minimal_val::B, "");
+static_assert(enumbra::from_string<enums::big>("C").value() == enums::big::C, "");
+static_assert(enumbra::is_valid(enums::big::B), "");
+
+int main()
+{
+	return 0;
+}
@@ -0,0 +1,58 @@
+// Uses the enums through the C++20 module instead of the header.
+// Macros can't be exported from modules, the ENUMBRA_ macros are only available from the header.
+import enumbra_test;
+
+static void TestValueEnums()
+{
+	using namespace enums;
+
+	static_assert(enumbra::is_enumbra_value_enum<Signed8Test>, "is_enumbra_value_enum failed");
+	static_assert(enumbra::count<Unsigned64Test>() == 4, "count failed");
+	static_assert(enumbra::is_valid(Signed64Test::MIN), "is_valid failed");
+
+	constexpr auto MAXSuccess = enumbra::from_string<Unsigned64Test>("V_UINT32_MAX", 12);
+	static_assert(MAXSuccess.has_value() && MAXSuccess.value() == Unsigned64Test::V_UINT32_MAX, "from_string failed");
+	static_assert(!enumbra::from_string<test_string_parse>("EEE", 3).has_value(), "from_string failed");
+	static_assert(enumbra::to_string(errc::bad_address).size == 11, "to_string failed");
+	static_assert(enumbra::from_integer<Signed64Test>(enumbra::to_underlying(Signed64Test::MAX)).value() == Signed64Test::MAX, "from_integer failed");
+	static_assert(enumbra::enum_name<HexDiagonal>().size == 11, "enum_name failed");
+}
+
+static void TestFlagsEnums()
+{
+	using namespace enums;
+	using F = TestConstrainedFlags;
+
+	static_assert(enumbra::is_enumbra_flags_enum<TestSparseFlags>, "is_enumbra_flags_enum failed");
+	static_assert(((TestSparseFlags::B | TestSparseFlags::C) & TestSparseFlags::C) == TestSparseFlags::C, "operators failed");
+	static_assert(enumbra::flag_index(TestSparseFlags::D) == 2, "flag_index failed");
+	static_assert(enumbra::closure(F::BUFFERED) == (F::BUFFERED | F::SIGNED | F::CHECKSUMMED), "closure failed");
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_NONE | F::ENCRYPTED), "satisfies_constraints failed");
+	static_assert(presets::TestConstrainedFlags::SECURE == (F::ENCRYPTED | F::SIGNED | F::CHECKSUMMED), "presets failed");
+	static_assert(enumbra::from_string<F>("VERIFIED|ENCRYPTED").value() == presets::TestConstrainedFlags::SECURE, "from_string failed");
+	static_assert(enumbra::detail::streq_fixed_size<10>(enumbra::to_string(Blorp::big | Blorp::bigger).sv().str, "big|bigger"), "to_string failed");
+}
+
+static bool TestFlagsBatch()
+{
+	using enums::TestSparseFlags;
+
+	constexpr int count = 67;
+	TestSparseFlags values[count] = {};
+	int indices[count] = {};
+	enumbra::set_batch(values, count, TestSparseFlags::B | TestSparseFlags::D);
+	enumbra::unset_batch(values, count / 2, TestSparseFlags::D);
+	return enumbra::test_all_batch(values, count, TestSparseFlags::D, indices) == count - count / 2
+		&& indices[0] == count / 2
+		&& enumbra::count_matching(values, count, TestSparseFlags::B, TestSparseFlags::D) == count / 2;
+}
+
+int main()
+{
+	TestValueEnums();
+	TestFlagsEnums();
+
+	if (!TestFlagsBatch()) {
+		return 1;
+	}
+}
@@ -0,0 +1,83 @@
+// Runtime test of the out-of-line string lookups. enumbra_test.cpp is generated with --cppsrc and defines
+// to_string and from_string of the enums marked "out_of_line", they are not constexpr and can't be static_asserted.
+#include "enumbra_test.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	int failures = 0;
+
+	void Check(bool condition, const char* what, const char* name)
+	{
+		if (!condition)
+		{
+			std::printf("FAILED: %s (%s)\n", what, name);
+			failures++;
+		}
+	}
+
+	struct Entry
+	{
+		enums::OutOfLineTest value;
+		const char* name;
+	};
+
+	// Names of 3 to 7 characters, several share a length
+	constexpr Entry entries[] = {
+		{ enums::OutOfLineTest::Sun, "Sun" },
+		{ enums::OutOfLineTest::Moon, "Moon" },
+		{ enums::OutOfLineTest::Earth, "Earth" },
+		{ enums::OutOfLineTest::Venus, "Venus" },
+		{ enums::OutOfLineTest::Saturn, "Saturn" },
+		{ enums::OutOfLineTest::Mercury, "Mercury" },
+		{ enums::OutOfLineTest::Jupiter, "Jupiter" },
+		{ enums::OutOfLineTest::Neptune, "Neptune" },
+	};
+
+	void TestToString()
+	{
+		for (const Entry& e : entries)
+		{
+			const enumbra::string_view sv = enumbra::to_string(e.value);
+			const auto length = static_cast<enumbra::string_view::size_type>(std::strlen(e.name));
+			Check(sv.size == length && std::memcmp(sv.str, e.name, std::strlen(e.name)) == 0, "to_string", e.name);
+		}
+		Check(enumbra::to_string(static_cast<enums::OutOfLineTest>(100)).empty(), "to_string of an invalid value", "100");
+	}
+
+	void TestFromString()
+	{
+		for (const Entry& e : entries)
+		{
+			const int length = static_cast<int>(std::strlen(e.name));
+			const auto with_length = enumbra::from_string<enums::OutOfLineTest>(e.name, length);
+			Check(with_length.has_value() && with_length.value() == e.value, "from_string(str, len)", e.name);
+			const auto terminated = enumbra::from_string<enums::OutOfLineTest>(e.name);
+			Check(terminated.has_value() && terminated.value() == e.value, "from_string(str)", e.name);
+			// Prefixes are a length with other or no names
+			Check(!enumbra::from_string<enums::OutOfLineTest>(e.name, length - 1).has_value(), "from_string of a prefix", e.name);
+		}
+
+		// Lengths with names, but no matching name
+		const char* const misses[] = { "Sum", "Mood", "Pluto", "Uranus", "Mercure", "sun", "NEPTUNE" };
+		for (const char* miss : misses)
+		{
+			Check(!enumbra::from_string<enums::OutOfLineTest>(miss, static_cast<int>(std::strlen(miss))).has_value(), "from_string(str, len) of a miss", miss);
+			Check(!enumbra::from_string<enums::OutOfLineTest>(miss).has_value(), "from_string(str) of a miss", miss);
+		}
+
+		// Lengths without names
+		Check(!enumbra::from_string<enums::OutOfLineTest>("").has_value(), "from_string of an empty string", "");
+		Check(!enumbra::from_string<enums::OutOfLineTest>("SaturnV1").has_value(), "from_string of a longer name", "SaturnV1");
+		Check(!enumbra::from_string<enums::OutOfLineTest>("Saturn", 0).has_value(), "from_string with length 0", "Saturn");
+	}
+}
+
+int main()
+{
+	TestToString();
+	TestFromString();
+	return failures == 0 ? 0 : 1;
+}
@@ -530,6 +530,170 @@ static void TestFlagsFromString()
 	}
 }
 
+static void TestFlagsIndex()
+{
+	using namespace enums;
+
+	// Sparse layout goes through the compaction table
+	static_assert(enumbra::flag_index(TestSparseFlags::B) == 0, "failed");
+	static_assert(enumbra::flag_index(TestSparseFlags::C) == 1, "failed");
+	static_assert(enumbra::flag_index(TestSparseFlags::D) == 2, "failed");
+	static_assert(enumbra::flag_index(TestSparseFlags()) == -1, "failed");
+	static_assert(enumbra::flag_index(TestSparseFlags::B | TestSparseFlags::C) == -1, "failed");
+	static_assert(enumbra::flag_index(enumbra::from_integer_unsafe<TestSparseFlags>(2)) == -1, "failed");
+	static_assert(enumbra::flag_index(enumbra::from_integer_unsafe<TestSparseFlags>(32)) == -1, "failed");
+	static_assert(enumbra::flag_from_index<TestSparseFlags>(0) == TestSparseFlags::B, "failed");
+	static_assert(enumbra::flag_from_index<TestSparseFlags>(2) == TestSparseFlags::D, "failed");
+	static_assert(enumbra::flag_from_index<TestSparseFlags>(3) == TestSparseFlags(), "failed");
+	static_assert(enumbra::flag_from_index<TestSparseFlags>(-1) == TestSparseFlags(), "failed");
+
+	// Contiguous layouts, including one that does not start at bit 0
+	static_assert(enumbra::flag_index(Blorp::biggest) == 2, "failed");
+	static_assert(enumbra::flag_from_index<Blorp>(1) == Blorp::bigger, "failed");
+	static_assert(enumbra::flag_index(TestSingleFlag::C) == 0, "failed");
+	static_assert(enumbra::flag_index(enumbra::from_integer_unsafe<TestSingleFlag>(2)) == -1, "failed");
+	static_assert(enumbra::flag_from_index<TestSingleFlag>(0) == TestSingleFlag::C, "failed");
+	static_assert(enumbra::flag_from_index<TestSingleFlag>(1) == TestSingleFlag(), "failed");
+
+	static_assert(enumbra::count_set(TestSparseFlags()) == 0, "failed");
+	static_assert(enumbra::count_set(TestSparseFlags::B | TestSparseFlags::D) == 2, "failed");
+	static_assert(enumbra::count_set(enumbra::from_integer_unsafe<TestSparseFlags>(0xFFFF)) == 3, "failed");
+	static_assert(enumbra::lowest_set(TestSparseFlags::C | TestSparseFlags::D) == TestSparseFlags::C, "failed");
+	static_assert(enumbra::lowest_set(TestSparseFlags()) == TestSparseFlags(), "failed");
+	static_assert(enumbra::highest_set(TestSparseFlags::B | TestSparseFlags::C) == TestSparseFlags::C, "failed");
+	static_assert(enumbra::highest_set(enumbra::from_integer_unsafe<TestSparseFlags>(0xFFFF)) == TestSparseFlags::D, "failed");
+	static_assert(enumbra::highest_set(TestSparseFlags()) == TestSparseFlags(), "failed");
+}
+
+static void TestFlagsConstraints()
+{
+	using namespace enums;
+	using F = TestConstrainedFlags;
+
+	static_assert(enumbra::satisfies_constraints(F::COMPRESS_LZ4), "failed");
+	static_assert(enumbra::satisfies_constraints(F::COMPRESS_NONE | F::STREAMING), "failed");
+	static_assert(enumbra::satisfies_constraints(F::COMPRESS_ZSTD | F::ENCRYPTED | F::SIGNED | F::CHECKSUMMED), "failed");
+
+	// exactly_one
+	static_assert(!enumbra::satisfies_constraints(F()), "failed");
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_LZ4 | F::COMPRESS_ZSTD), "failed");
+	// exclusive
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_NONE | F::STREAMING | F::BUFFERED | F::SIGNED | F::CHECKSUMMED), "failed");
+	// requires
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_NONE | F::ENCRYPTED), "failed");
+	// implies
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_NONE | F::SIGNED), "failed");
+	// undefined bits
+	static_assert(!enumbra::satisfies_constraints(F::COMPRESS_NONE | enumbra::from_integer_unsafe<F>(256)), "failed");
+
+	// closure applies implications transitively, requirements are not added
+	static_assert(enumbra::closure(F::BUFFERED) == (F::BUFFERED | F::SIGNED | F::CHECKSUMMED), "failed");
+	static_assert(enumbra::closure(F::SIGNED | F::COMPRESS_LZ4) == (F::SIGNED | F::CHECKSUMMED | F::COMPRESS_LZ4), "failed");
+	static_assert(enumbra::closure(F::ENCRYPTED) == F::ENCRYPTED, "failed");
+	static_assert(enumbra::satisfies_constraints(enumbra::closure(F::COMPRESS_NONE | F::BUFFERED)), "failed");
+
+	// Enums without constraints only check for undefined bits
+	static_assert(enumbra::satisfies_constraints(TestSparseFlags::B | TestSparseFlags::D), "failed");
+	static_assert(!enumbra::satisfies_constraints(enumbra::from_integer_unsafe<TestSparseFlags>(2)), "failed");
+	static_assert(enumbra::closure(TestSparseFlags::B) == TestSparseFlags::B, "failed");
+}
+
+static void TestFlagsPresets()
+{
+	using namespace enums;
+	using F = TestConstrainedFlags;
+
+	static_assert(presets::TestConstrainedFlags::VERIFIED == (F::SIGNED | F::CHECKSUMMED), "failed");
+	static_assert(presets::TestConstrainedFlags::SECURE == (F::ENCRYPTED | F::SIGNED | F::CHECKSUMMED), "failed");
+
+	// from_string accepts presets alongside flags
+	{
+		constexpr auto res = enumbra::from_string<F>("SECURE|COMPRESS_LZ4");
+		static_assert(res.has_value(), "failed");
+		static_assert(res.value() == (presets::TestConstrainedFlags::SECURE | F::COMPRESS_LZ4), "failed");
+	}
+	{
+		constexpr auto res = enumbra::from_string<F>("VERIFIED|ENCRYPTED");
+		static_assert(res.has_value(), "failed");
+		static_assert(res.value() == presets::TestConstrainedFlags::SECURE, "failed");
+	}
+
+	// to_string prefers the largest presets that are fully set
+	static_assert(enumbra::detail::streq_fixed_size<19>(enumbra::to_string(F::COMPRESS_LZ4 | F::ENCRYPTED | F::SIGNED | F::CHECKSUMMED).sv().str, "SECURE|COMPRESS_LZ4"), "failed");
+	static_assert(enumbra::to_string(F::SIGNED | F::CHECKSUMMED).sv().size == 8, "failed");
+	static_assert(enumbra::detail::streq_fixed_size<8>(enumbra::to_string(F::SIGNED | F::CHECKSUMMED).sv().str, "VERIFIED"), "failed");
+	static_assert(enumbra::detail::streq_fixed_size<16>(enumbra::to_string(F::ENCRYPTED | F::SIGNED).sv().str, "ENCRYPTED|SIGNED"), "failed");
+	static_assert(enumbra::to_string(F()).sv().empty(), "failed");
+}
+
+template<class T>
+static bool TestFlagsBatchType(const T* flags, int flags_count)
+{
+	// Long enough to cover full vectors, a partial selection word, and a scalar tail
+	constexpr int count = 203;
+	T values[count] = {};
+	for (int i = 0; i < count; ++i) {
+		for (int f = 0; f < flags_count; ++f) {
+			if (((i * 7 + f * 3) % (f + 2)) == 0) { enumbra::set(values[i], flags[f]); }
+		}
+	}
+
+	const T required = flags[0];
+	const T excluded = flags[flags_count - 1];
+
+	unsigned long long selection[(count + 63) / 64] = {};
+	int indices[count] = {};
+	int expected_all = 0;
+	int expected_any = 0;
+	int expected_matching = 0;
+	for (int i = 0; i < count; ++i) {
+		expected_all += enumbra::test(values[i], required) ? 1 : 0;
+		expected_any += enumbra::has_any(values[i] & (required | excluded)) ? 1 : 0;
+		expected_matching += (enumbra::test(values[i], required) && !enumbra::has_any(values[i] & excluded)) ? 1 : 0;
+	}
+
+	if (enumbra::test_all_batch(values, count, required, selection) != expected_all) { return false; }
+	for (int i = 0; i < count; ++i) {
+		const bool bit = ((selection[i / 64] >> (i % 64)) & 1ULL) != 0;
+		if (bit != enumbra::test(values[i], required)) { return false; }
+	}
+	const int all_found = enumbra::test_all_batch(values, count, required, indices);
+	if (all_found != expected_all) { return false; }
+	for (int i = 0; i < all_found; ++i) {
+		if (!enumbra::test(values[indices[i]], required)) { return false; }
+		if ((i > 0) && (indices[i] <= indices[i - 1])) { return false; }
+	}
+
+	if (enumbra::test_any_batch(values, count, required | excluded, selection) != expected_any) { return false; }
+	for (int i = 0; i < count; ++i) {
+		const bool bit = ((selection[i / 64] >> (i % 64)) & 1ULL) != 0;
+		if (bit != enumbra::has_any(values[i] & (required | excluded))) { return false; }
+	}
+	if (enumbra::test_any_batch(values, count, required | excluded, indices) != expected_any) { return false; }
+
+	if (enumbra::count_matching(values, count, required, excluded) != expected_matching) { return false; }
+
+	enumbra::set_batch(values, count, required);
+	if (enumbra::test_all_batch(values, count, required, indices) != count) { return false; }
+	enumbra::unset_batch(values, count, required);
+	if (enumbra::test_any_batch(values, count, required, indices) != 0) { return false; }
+
+	return true;
+}
+
+static bool TestFlagsBatch()
+{
+	using namespace enums;
+
+	const auto& test_flags_arr = enumbra::flags<test_flags>();
+	const auto& sparse_arr = enumbra::flags<TestSparseFlags>();
+	const auto& blorp_arr = enumbra::flags<Blorp>();
+
+	return TestFlagsBatchType(test_flags_arr, 2)
+		&& TestFlagsBatchType(sparse_arr, 3)
+		&& TestFlagsBatchType(blorp_arr, 3);
+}
+
 int main()
 {
 	TestMacroWithUsingNamespace();
@@ -544,4 +708,11 @@ int main()
 	TestBitMacros();
 	TestFlagsToString();
 	TestFlagsFromString();
+	TestFlagsIndex();
+	TestFlagsConstraints();
+	TestFlagsPresets();
+
+	if (!TestFlagsBatch()) {
+		return 1;
+	}
 }
@@ -3,8 +3,8 @@
 // as they will be overwritten when the file is re-generated.
 // Generated by enumbra v0.2.3
 
-#ifndef ENUMBRA_8DFC7B86EEA68504_H
-#define ENUMBRA_8DFC7B86EEA68504_H
+#ifndef ENUMBRA_FE568FF0FED14534_H
+#define ENUMBRA_FE568FF0FED14534_H
 
 
 #if !defined(ENUMBRA_REQUIRED_MACROS_VERSION)
@@ -80,7 +80,7 @@
 #endif
 
 #if !defined(ENUMBRA_BASE_TEMPLATES_VERSION)
-#define ENUMBRA_BASE_TEMPLATES_VERSION 31
+#define ENUMBRA_BASE_TEMPLATES_VERSION 35
 namespace enumbra {
     namespace detail {
         // Re-Implementation of std:: features to avoid including std headers
@@ -157,6 +157,40 @@ namespace enumbra {
             while (a[count] != 0) { count++; }
             return count;
         }
+        // Number of set bits
+        constexpr int popcount(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(v);
+#else
+            v = v - ((v >> 1) & 0x5555555555555555ULL);
+            v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+        // Position of the lowest set bit, v must not be 0
+        constexpr int countr_zero(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(v);
+#else
+            return popcount((v & (~v + 1)) - 1);
+#endif
+        }
+        // Position of the highest set bit, v must not be 0
+        constexpr int highest_bit(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(v);
+#else
+            int bit = 0;
+            if (v >> 32) { v >>= 32; bit += 32; }
+            if (v >> 16) { v >>= 16; bit += 16; }
+            if (v >> 8) { v >>= 8; bit += 8; }
+            if (v >> 4) { v >>= 4; bit += 4; }
+            if (v >> 2) { v >>= 2; bit += 2; }
+            if (v >> 1) { bit += 1; }
+            return bit;
+#endif
+        }
     } // end namespace enumbra::detail
 
     template<class T>
@@ -260,9 +294,9 @@ namespace enumbra {
             }
         }
 
-        constexpr bool has_value() const { return operator bool(); }
+        constexpr bool has_value() const { return static_cast<bool>(*this); }
         constexpr T value() const { return v; }
-        constexpr T value_or(T default_value) const { return operator bool() ? v : default_value; }
+        constexpr T value_or(T default_value) const { return static_cast<bool>(*this) ? v : default_value; }
     };
 
     struct string_view {
@@ -355,6 +389,44 @@ namespace enumbra {
     template<class T>
     constexpr bool has_single(T value) noexcept = delete;
 
+    // True if value only contains defined flags and meets every constraint declared in the schema
+    template<class T>
+    constexpr bool satisfies_constraints(T value) noexcept = delete;
+
+    // Sets every flag implied by the flags in value
+    template<class T>
+    constexpr T closure(T value) noexcept = delete;
+
+    // Ordinal of a single flag within flags<T>(), or -1 if flag is not exactly one defined flag
+    template<class T>
+    constexpr int flag_index(T flag) noexcept = delete;
+
+    // Inverse of flag_index, returns T() if index is out of range
+    template<class T>
+    constexpr T flag_from_index(int index) noexcept = delete;
+
+    template<class T>
+    constexpr int count_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        return detail::popcount(static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max));
+    }
+
+    // Returns the lowest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T lowest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>(n & (~n + 1));
+    }
+
+    // Returns the highest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T highest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>((n != 0) ? (1ULL << detail::highest_bit(n)) : 0ULL);
+    }
+
     template<typename Value, typename Func>
     constexpr void flags_switch(Value v, Func&& func) {
         static_assert(::enumbra::is_enumbra_flags_enum<Value>, "Value is not an enumbra flags enum");
@@ -365,14 +437,89 @@ namespace enumbra {
         }
     }
 
+    // Batch operations over contiguous arrays of flags values.
+    // selection receives one bit per value and must hold at least (count + 63) / 64 words.
+    // indices receives the index of each matching value and must hold at least count entries.
+    // Each returns the number of matching values. Generated headers may specialize these with SIMD kernels.
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::test(values[i], flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::has_any(values[i] & flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::has_any(values[i] & flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    // Counts values that have every flag in all_of set and every flag in none_of unset.
+    template<class T>
+    constexpr int count_matching(const T* values, int count, T all_of, T none_of) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) { ++matches; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr void set_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::set(values[i], flags); }
+    }
+
+    template<class T>
+    constexpr void unset_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::unset(values[i], flags); }
+    }
+
     // End Default Templates
 } // end namespace enumbra
 #else // check existing version supported
 #if (ENUMBRA_BASE_TEMPLATES_VERSION + 0) == 0
 #error ENUMBRA_BASE_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
-#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) < 31
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) < 35
 #error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
-#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) > 31
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) > 35
 #error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
 #endif // check existing version supported
 #endif // ENUMBRA_BASE_TEMPLATES_VERSION
@@ -388,12 +535,12 @@ template<> struct enumbra::detail::base_helper<::enums::minimal_val> : enumbra::
 template<> struct enumbra::detail::enum_helper<::enums::minimal_val> : enumbra::detail::enum_info<unsigned int, 1, 2, 1, 2, true, 2, 1, true, 0> { };
 
 namespace enums::detail::minimal_val {
-constexpr ::enums::minimal_val values_arr[2] =
+inline constexpr ::enums::minimal_val values_arr[2] =
 {
 ::enums::minimal_val::B,
 ::enums::minimal_val::C,
 };
-constexpr const char enum_strings[5] = {
+inline constexpr const char enum_strings[5] = {
 "B\0"
 "C\0"
 };
@@ -473,12 +620,12 @@ template<> struct enumbra::detail::base_helper<::enums::big> : enumbra::detail::
 template<> struct enumbra::detail::enum_helper<::enums::big> : enumbra::detail::enum_info<unsigned long long, 0x12D687, 0x54F9338, 0x12D687, 2, false, 27, 27, true, 0> { };
 
 namespace enums::detail::big {
-constexpr ::enums::big values_arr[2] =
+inline constexpr ::enums::big values_arr[2] =
 {
 ::enums::big::B,
 ::enums::big::C,
 };
-constexpr const char enum_strings[5] = {
+inline constexpr const char enum_strings[5] = {
 "B\0"
 "C\0"
 };
@@ -560,7 +707,7 @@ C = 2,
 };
 
 namespace detail::minimal {
-constexpr ::enums::minimal flags_arr[2] =
+inline constexpr ::enums::minimal flags_arr[2] =
 {
 ::enums::minimal::B,
 ::enums::minimal::C,
@@ -591,6 +738,21 @@ template<> constexpr bool has_any(::enums::minimal value) noexcept { return (sta
 template<> constexpr bool has_none(::enums::minimal value) noexcept { return (static_cast<unsigned int>(value) & static_cast<unsigned int>(0x3)) == 0; }
 template<> constexpr bool has_single(::enums::minimal value) noexcept { unsigned int n = static_cast<unsigned int>(static_cast<unsigned int>(value) & 0x3); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::minimal flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x3) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::minimal flag_from_index<::enums::minimal>(int index) noexcept { return (index >= 0 && index < 2) ? static_cast<::enums::minimal>(1ULL << (index + 0)) : ::enums::minimal(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::minimal value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x3) == 0x3)
+;
+}
+
+template<>
+constexpr ::enums::minimal closure(::enums::minimal value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::minimal> : enumbra::detail::type_info<true, false, true> { };
@@ -650,4 +812,4 @@ constexpr ::enumbra::optional_value<::enums::minimal> from_string<::enums::minim
 }
 } // namespace enumbra
 
-#endif // ENUMBRA_8DFC7B86EEA68504_H
+#endif // ENUMBRA_FE568FF0FED14534_H
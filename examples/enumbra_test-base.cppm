@@ -0,0 +1,683 @@
+// THIS FILE WAS GENERATED BY A TOOL: https://github.com/Scaless/enumbra
+// It is highly recommended that you not make manual edits to this file,
+// as they will be overwritten when the file is re-generated.
+// Generated by enumbra v0.2.3
+
+// This is where you would put your code license!
+
+module;
+#include <cstdint>
+
+#if !defined(ENUMBRA_REQUIRED_MACROS_VERSION)
+#define ENUMBRA_REQUIRED_MACROS_VERSION 9
+
+// Find out what language version we're using
+// 2024-07-04:MSVC Doesn't officially support C++23 yet
+#if (__cplusplus >= 202302L)
+#define ENUMBRA_CPP_VERSION 23
+#elif ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) || (__cplusplus >= 202002L)
+#define ENUMBRA_CPP_VERSION 20
+#elif ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) || (__cplusplus >= 201703L)
+#define ENUMBRA_CPP_VERSION 17
+#else
+#error Headers generated by enumbra require a compiler that supports C++17 or higher.
+#endif
+
+#if defined(__clang__)
+#define ENUMBRA_COMPILER_CLANG
+#elif defined(__GNUG__)
+#define ENUMBRA_COMPILER_GCC
+#elif defined(_MSC_VER)
+#define ENUMBRA_COMPILER_MSVC
+#else
+#define ENUMBRA_COMPILER_UNKNOWN
+#endif
+
+#else // check existing version supported
+#if (ENUMBRA_REQUIRED_MACROS_VERSION + 0) == 0
+#error ENUMBRA_REQUIRED_MACROS_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_REQUIRED_MACROS_VERSION + 0) < 9
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using the same version.
+#elif (ENUMBRA_REQUIRED_MACROS_VERSION + 0) > 9
+#error An included header was generated using an older version of enumbra. Regenerate your headers using the same version.
+#endif // end check existing version supported
+#endif // ENUMBRA_REQUIRED_MACROS_VERSION
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENUMBRA_SIMD_SSE2
+#if defined(__AVX2__)
+#define ENUMBRA_SIMD_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
+export module enumbra_test:base;
+
+#if !defined(ENUMBRA_BASE_TEMPLATES_VERSION)
+#define ENUMBRA_BASE_TEMPLATES_VERSION 35
+export namespace enumbra {
+    namespace detail {
+        // Re-Implementation of std:: features to avoid including std headers
+        template<bool B, class T, class F>
+        struct conditional { using type = T; };
+        template<class T, class F>
+        struct conditional<false, T, F> { using type = F; };
+        template<bool B, class T, class F>
+        using conditional_t = typename conditional<B, T, F>::type;
+
+ #if defined(__cpp_lib_is_constant_evaluated)
+        // Supported on clang/gcc/MSVC in C++17, even though it's only in the C++20 standard. 
+        constexpr bool is_constant_evaluated() noexcept { return __builtin_is_constant_evaluated(); }
+#else
+        constexpr bool is_constant_evaluated() noexcept { return false; }
+#endif
+
+        // Type info
+        template<bool is_enumbra, bool is_value_enum, bool is_flags_enum>
+        struct type_info {
+            static constexpr bool enumbra_type = is_enumbra;
+            static constexpr bool enumbra_value_enum = is_value_enum;
+            static constexpr bool enumbra_flags_enum = is_flags_enum;
+        };
+
+        // Enum info
+        template<
+            typename underlying_type,
+            underlying_type min_v,
+            underlying_type max_v,
+            underlying_type default_v,
+            int count_v,
+            bool is_contiguous_v,
+            int bits_required_storage_v,
+            int bits_required_transmission_v,
+            bool has_invalid_sentinel_v,
+            underlying_type invalid_sentinel_v
+        >
+        struct enum_info {
+            using underlying_t = underlying_type;
+            static constexpr underlying_type min = min_v;
+            static constexpr underlying_type max = max_v;
+            static constexpr underlying_type default_value = default_v;
+            static constexpr int count = count_v;
+            static constexpr bool is_contiguous = is_contiguous_v;
+            static constexpr int bits_required_storage = bits_required_storage_v;
+            static constexpr int bits_required_transmission = bits_required_transmission_v;
+            static constexpr bool has_invalid_sentinel = has_invalid_sentinel_v;
+            static constexpr underlying_type invalid_sentinel = invalid_sentinel_v;
+        };
+
+        // Default template for non-enumbra types
+        template<class T>
+        struct base_helper : type_info<false, false, false> { };
+        template<class T>
+        struct enum_helper;
+
+        // Compare strings with sizes only known at runtime
+        constexpr bool streq_known_size(const char* a, const char* b, int len) noexcept {
+            for(int i = 0; i < len; ++i) { if(a[i] != b[i]) { return false; } }
+            return true;
+        }
+        // Compare strings with sizes known at compile time
+        template<int length>
+        constexpr bool streq_fixed_size(const char* a, const char* b) noexcept {
+            static_assert(length > 0);
+            for(int i = 0; i < length; ++i) { if(a[i] != b[i]) { return false; } }
+            return true;
+        }
+        // C-style string length
+        constexpr int strlen(const char* a) noexcept {
+            if (a == nullptr) { return 0; }
+            int count = 0;
+            while (a[count] != 0) { count++; }
+            return count;
+        }
+        // Number of set bits
+        constexpr int popcount(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(v);
+#else
+            v = v - ((v >> 1) & 0x5555555555555555ULL);
+            v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+        // Position of the lowest set bit, v must not be 0
+        constexpr int countr_zero(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(v);
+#else
+            return popcount((v & (~v + 1)) - 1);
+#endif
+        }
+        // Position of the highest set bit, v must not be 0
+        constexpr int highest_bit(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(v);
+#else
+            int bit = 0;
+            if (v >> 32) { v >>= 32; bit += 32; }
+            if (v >> 16) { v >>= 16; bit += 16; }
+            if (v >> 8) { v >>= 8; bit += 8; }
+            if (v >> 4) { v >>= 4; bit += 4; }
+            if (v >> 2) { v >>= 2; bit += 2; }
+            if (v >> 1) { bit += 1; }
+            return bit;
+#endif
+        }
+    } // end namespace enumbra::detail
+
+    template<class T>
+    constexpr bool is_enumbra_enum = detail::base_helper<T>::enumbra_type;
+    template<class T>
+    constexpr bool is_enumbra_value_enum = detail::base_helper<T>::enumbra_value_enum;
+    template<class T>
+    constexpr bool is_enumbra_flags_enum = detail::base_helper<T>::enumbra_flags_enum;
+
+    template<class T>
+    constexpr T min() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return static_cast<T>(detail::enum_helper<T>::min);
+    }
+
+    template<class T>
+    constexpr T max() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return static_cast<T>(detail::enum_helper<T>::max);
+    }
+
+    template<class T>
+    constexpr T default_value() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return static_cast<T>(detail::enum_helper<T>::default_value);
+    }
+
+    template<class T>
+    constexpr int count() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return detail::enum_helper<T>::count;
+    }
+
+    template<class T>
+    constexpr bool is_contiguous() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return detail::enum_helper<T>::is_contiguous;
+    }
+
+    template<class T>
+    constexpr int bits_required_storage() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return detail::enum_helper<T>::bits_required_storage;
+    }
+ 
+    template<class T>
+    constexpr int bits_required_transmission() {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return detail::enum_helper<T>::bits_required_transmission;
+    }
+
+    template<class T, class underlying_type>
+    constexpr T from_integer_unsafe(underlying_type e) noexcept {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return static_cast<T>(e);
+    }
+
+    template<class T>
+    constexpr auto to_underlying(T e) noexcept {
+        static_assert(is_enumbra_enum<T>, "T is not an enumbra enum");
+        return static_cast<typename detail::enum_helper<T>::underlying_t>(e);
+    }
+
+    namespace detail {
+        template<class T>
+        struct optional_result_base_bool 
+        {
+        private:
+            using bool_type = 
+                detail::conditional_t<sizeof(T) == 1, char,
+                detail::conditional_t<sizeof(T) == 2, short,
+                detail::conditional_t<sizeof(T) == 4, int,
+                detail::conditional_t<sizeof(T) == 8, long long,
+                void /* invalid size */>>>>;
+        protected:
+            bool_type success = 0;
+        };
+        
+        struct optional_result_base_inplace { };
+    }
+
+    template<class T, bool use_invalid_sentinel = detail::enum_helper<T>::has_invalid_sentinel>
+    struct optional_value : detail::conditional_t<use_invalid_sentinel, detail::optional_result_base_inplace, detail::optional_result_base_bool<T>>
+    {
+    private:
+        T v = static_cast<T>(detail::enum_helper<T>::invalid_sentinel);
+    public:
+        constexpr optional_value() : v(static_cast<T>(detail::enum_helper<T>::invalid_sentinel)) { }
+
+        constexpr explicit optional_value(T value) : v(value) {
+            if constexpr(!use_invalid_sentinel) {
+                this->success = 1;
+            }
+        }
+
+        constexpr explicit operator bool() const noexcept {
+            if constexpr (use_invalid_sentinel) {
+                return v != static_cast<T>(detail::enum_helper<T>::invalid_sentinel);
+            } else {
+                return this->success > 0;
+            }
+        }
+
+        constexpr bool has_value() const { return static_cast<bool>(*this); }
+        constexpr T value() const { return v; }
+        constexpr T value_or(T default_value) const { return static_cast<bool>(*this) ? v : default_value; }
+    };
+
+    struct string_view {
+        using size_type = detail::conditional_t<sizeof(void*) == 4, int, long long>;
+
+        const char* str = nullptr;
+        size_type size = 0;
+
+        constexpr bool empty() const { return size == 0; }
+    };
+
+	template<int buf_size>
+	struct stack_string {
+		static_assert(buf_size > 0, "invalid buf_size");
+		static_assert(((buf_size + sizeof(int)) % 16) == 0, "invalid buf_size");
+
+		template<int length>
+		constexpr void append(const char* from) {
+			for (int i = 0; i < length; ++i) { 
+				buffer[data_size+i] = from[i]; 
+			}
+			data_size += length;
+		}
+
+		constexpr void append(char c) {
+			buffer[data_size] = c;
+			data_size += 1;
+		}
+
+		constexpr int size() { return data_size; }
+		constexpr bool empty() { return data_size == 0; }
+		constexpr string_view sv() { return { &buffer[0], data_size }; }
+	private:
+		int data_size = 0;
+		char buffer[buf_size] = {};
+	};
+
+    // Begin Default Templates
+    template<class T>
+    constexpr optional_value<T> from_string(const char* str, int len) noexcept = delete;
+
+    template<class T>
+    constexpr optional_value<T> from_string(const char* str) noexcept = delete;
+
+    template<class T, class underlying_type>
+    constexpr optional_value<T> from_integer(underlying_type value) noexcept = delete;
+
+    template<class T>
+    constexpr auto& values() noexcept = delete;
+
+    template<class T>
+    constexpr auto& flags() noexcept = delete;
+
+    template<class T>
+    constexpr bool is_valid(T e) noexcept = delete;
+
+    template<class T>
+    constexpr string_view enum_name() noexcept = delete;
+
+    template<class T>
+    constexpr string_view enum_name_with_namespace() noexcept = delete;
+
+    template<class T>
+    constexpr string_view enum_namespace() noexcept = delete;
+
+    template<class T>
+    constexpr void clear(T& value) noexcept = delete;
+
+    template<class T>
+    constexpr bool test(T value, T flags) noexcept = delete;
+
+    template<class T>
+    constexpr void set(T& value, T flags) noexcept = delete;
+
+    template<class T>
+    constexpr void unset(T& value, T flags) noexcept = delete;
+
+    template<class T>
+    constexpr void toggle(T& value, T flags) noexcept = delete;
+
+    template<class T>
+    constexpr bool has_all(T value) noexcept = delete;
+
+    template<class T>
+    constexpr bool has_any(T value) noexcept = delete;
+
+    template<class T>
+    constexpr bool has_none(T value) noexcept = delete;
+
+    template<class T>
+    constexpr bool has_single(T value) noexcept = delete;
+
+    // True if value only contains defined flags and meets every constraint declared in the schema
+    template<class T>
+    constexpr bool satisfies_constraints(T value) noexcept = delete;
+
+    // Sets every flag implied by the flags in value
+    template<class T>
+    constexpr T closure(T value) noexcept = delete;
+
+    // Ordinal of a single flag within flags<T>(), or -1 if flag is not exactly one defined flag
+    template<class T>
+    constexpr int flag_index(T flag) noexcept = delete;
+
+    // Inverse of flag_index, returns T() if index is out of range
+    template<class T>
+    constexpr T flag_from_index(int index) noexcept = delete;
+
+    template<class T>
+    constexpr int count_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        return detail::popcount(static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max));
+    }
+
+    // Returns the lowest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T lowest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>(n & (~n + 1));
+    }
+
+    // Returns the highest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T highest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>((n != 0) ? (1ULL << detail::highest_bit(n)) : 0ULL);
+    }
+
+    template<typename Value, typename Func>
+    constexpr void flags_switch(Value v, Func&& func) {
+        static_assert(::enumbra::is_enumbra_flags_enum<Value>, "Value is not an enumbra flags enum");
+        for (const Value flag : ::enumbra::flags<Value>()) {
+            if (::enumbra::has_any(v & flag)) {
+                func(v & flag);
+            }
+        }
+    }
+
+    // Batch operations over contiguous arrays of flags values.
+    // selection receives one bit per value and must hold at least (count + 63) / 64 words.
+    // indices receives the index of each matching value and must hold at least count entries.
+    // Each returns the number of matching values. Generated headers may specialize these with SIMD kernels.
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::test(values[i], flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::has_any(values[i] & flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::has_any(values[i] & flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    // Counts values that have every flag in all_of set and every flag in none_of unset.
+    template<class T>
+    constexpr int count_matching(const T* values, int count, T all_of, T none_of) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) { ++matches; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr void set_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::set(values[i], flags); }
+    }
+
+    template<class T>
+    constexpr void unset_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::unset(values[i], flags); }
+    }
+
+    // End Default Templates
+} // end namespace enumbra
+#else // check existing version supported
+#if (ENUMBRA_BASE_TEMPLATES_VERSION + 0) == 0
+#error ENUMBRA_BASE_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) < 35
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) > 35
+#error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
+#endif // check existing version supported
+#endif // ENUMBRA_BASE_TEMPLATES_VERSION
+
+
+#if !defined(ENUMBRA_SIMD_TEMPLATES_VERSION)
+#define ENUMBRA_SIMD_TEMPLATES_VERSION 1
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENUMBRA_SIMD_SSE2
+#if defined(__AVX2__)
+#define ENUMBRA_SIMD_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+export namespace enumbra::detail::simd {
+    constexpr int popcount(unsigned int m) noexcept {
+        m = m - ((m >> 1) & 0x55555555u);
+        m = (m & 0x33333333u) + ((m >> 2) & 0x33333333u);
+        return static_cast<int>((((m + (m >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+    }
+
+    struct sse2 {
+        using vec = __m128i;
+        static constexpr int width = 16;
+        template<class T> static vec load(const T* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(p))); }
+        template<class T> static void store(T* p, vec v) noexcept { _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), v); }
+        static vec zero() noexcept { return _mm_setzero_si128(); }
+        static vec and_(vec a, vec b) noexcept { return _mm_and_si128(a, b); }
+        static vec or_(vec a, vec b) noexcept { return _mm_or_si128(a, b); }
+        static vec andnot(vec a, vec b) noexcept { return _mm_andnot_si128(a, b); }
+        template<class U> static vec broadcast(U v) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm_set1_epi8(static_cast<char>(v)); }
+            else if constexpr (sizeof(U) == 2) { return _mm_set1_epi16(static_cast<short>(v)); }
+            else if constexpr (sizeof(U) == 4) { return _mm_set1_epi32(static_cast<int>(v)); }
+            else { return _mm_set1_epi64x(static_cast<long long>(v)); }
+        }
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(U) == 2) { return _mm_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(U) == 4) { return _mm_cmpeq_epi32(a, b); }
+            else { const vec c = _mm_cmpeq_epi32(a, b); return _mm_and_si128(c, _mm_shuffle_epi32(c, 0xB1)); }
+        }
+        // One bit per lane of a comparison result
+        template<class U> static unsigned int lane_mask(vec m) noexcept {
+            if constexpr (sizeof(U) == 1) { return static_cast<unsigned int>(_mm_movemask_epi8(m)); }
+            else if constexpr (sizeof(U) == 2) { return static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()))); }
+            else if constexpr (sizeof(U) == 4) { return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+            else { return static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(m))); }
+        }
+    };
+
+#if defined(ENUMBRA_SIMD_AVX2)
+    struct avx2 {
+        using vec = __m256i;
+        static constexpr int width = 32;
+        template<class T> static vec load(const T* p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(p))); }
+        template<class T> static void store(T* p, vec v) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(p)), v); }
+        static vec zero() noexcept { return _mm256_setzero_si256(); }
+        static vec and_(vec a, vec b) noexcept { return _mm256_and_si256(a, b); }
+        static vec or_(vec a, vec b) noexcept { return _mm256_or_si256(a, b); }
+        static vec andnot(vec a, vec b) noexcept { return _mm256_andnot_si256(a, b); }
+        template<class U> static vec broadcast(U v) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm256_set1_epi8(static_cast<char>(v)); }
+            else if constexpr (sizeof(U) == 2) { return _mm256_set1_epi16(static_cast<short>(v)); }
+            else if constexpr (sizeof(U) == 4) { return _mm256_set1_epi32(static_cast<int>(v)); }
+            else { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+        }
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm256_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(U) == 2) { return _mm256_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(U) == 4) { return _mm256_cmpeq_epi32(a, b); }
+            else { return _mm256_cmpeq_epi64(a, b); }
+        }
+        // One bit per lane of a comparison result. packs works per 128-bit half, so restore lane order.
+        template<class U> static unsigned int lane_mask(vec m) noexcept {
+            if constexpr (sizeof(U) == 1) { return static_cast<unsigned int>(_mm256_movemask_epi8(m)); }
+            else if constexpr (sizeof(U) == 2) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(m, _mm256_setzero_si256()), 0xD8))) & 0xFFFFu; }
+            else if constexpr (sizeof(U) == 4) { return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+            else { return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+        }
+    };
+    using best = avx2;
+#else
+    using best = sse2;
+#endif
+
+    // Kernels process whole vectors, then finish the tail with the per-value specializations.
+    // U is the underlying type of T, lanes always divides 64 so a vector never straddles a selection word.
+    template<class B, class T, class U, bool all>
+    inline typename B::vec test_vec(const T* values, typename B::vec f) noexcept {
+        return B::template cmpeq<U>(B::and_(B::load(values), f), all ? f : B::zero());
+    }
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) { m = ~m & lane_bits; }
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            selection[i / 64] |= static_cast<unsigned long long>(m) << (i % 64);
+            matches += popcount(m);
+        }
+        for (; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, int* indices) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) { m = ~m & lane_bits; }
+            // Branchless compaction: always write, only advance on a match
+            for (int l = 0; l < lanes; ++l) {
+                indices[matches] = i + l;
+                matches += static_cast<int>((m >> l) & 1u);
+            }
+        }
+        for (; i < count; ++i) {
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U>
+    inline int count_matching(const T* values, int count, T all_of, T none_of) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec a = B::template broadcast<U>(static_cast<U>(all_of));
+        const typename B::vec n = B::template broadcast<U>(static_cast<U>(none_of));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            const typename B::vec v = B::load(values + i);
+            const typename B::vec has_all_of = B::template cmpeq<U>(B::and_(v, a), a);
+            const typename B::vec has_none_of = B::template cmpeq<U>(B::and_(v, n), B::zero());
+            matches += popcount(B::template lane_mask<U>(B::and_(has_all_of, has_none_of)));
+        }
+        for (; i < count; ++i) {
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) { ++matches; }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U, bool set>
+    inline void modify_batch(T* values, int count, T flags) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            const typename B::vec v = B::load(values + i);
+            B::store(values + i, set ? B::or_(v, f) : B::andnot(f, v));
+        }
+        for (; i < count; ++i) {
+            if constexpr (set) { ::enumbra::set(values[i], flags); } else { ::enumbra::unset(values[i], flags); }
+        }
+    }
+} // end namespace enumbra::detail::simd
+#endif // SSE2 available
+#else // check existing version supported
+#if (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) == 0
+#error ENUMBRA_SIMD_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) < 1
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) > 1
+#error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
+#endif // check existing version supported
+#endif // ENUMBRA_SIMD_TEMPLATES_VERSION
+
@@ -0,0 +1,59 @@
+// THIS FILE WAS GENERATED BY A TOOL: https://github.com/Scaless/enumbra
+// It is highly recommended that you not make manual edits to this file,
+// as they will be overwritten when the file is re-generated.
+// Generated by enumbra v0.2.3
+
+// This is where you would put your code license!
+
+#include "enumbra_test.hpp"
+
+namespace enums::detail::OutOfLineTest {
+inline constexpr const char enum_strings[53] = {
+"Sun\0"
+"Moon\0"
+"Earth\0"
+"Venus\0"
+"Saturn\0"
+"Mercury\0"
+"Jupiter\0"
+"Neptune\0"
+};
+}
+
+namespace enumbra {
+::enumbra::string_view to_string(const ::enums::OutOfLineTest v) noexcept {
+switch (v) {
+case ::enums::OutOfLineTest::Sun: return { &::enums::detail::OutOfLineTest::enum_strings[0], 3 };
+case ::enums::OutOfLineTest::Moon: return { &::enums::detail::OutOfLineTest::enum_strings[4], 4 };
+case ::enums::OutOfLineTest::Earth: return { &::enums::detail::OutOfLineTest::enum_strings[9], 5 };
+case ::enums::OutOfLineTest::Venus: return { &::enums::detail::OutOfLineTest::enum_strings[15], 5 };
+case ::enums::OutOfLineTest::Saturn: return { &::enums::detail::OutOfLineTest::enum_strings[21], 6 };
+case ::enums::OutOfLineTest::Mercury: return { &::enums::detail::OutOfLineTest::enum_strings[28], 7 };
+case ::enums::OutOfLineTest::Jupiter: return { &::enums::detail::OutOfLineTest::enum_strings[36], 7 };
+case ::enums::OutOfLineTest::Neptune: return { &::enums::detail::OutOfLineTest::enum_strings[44], 7 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_string<::enums::OutOfLineTest>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 1; break;
+case 4: offset_str = 4; offset_enum = 1; count = 1; break;
+case 5: offset_str = 9; offset_enum = 2; count = 2; break;
+case 6: offset_str = 21; offset_enum = 4; count = 1; break;
+case 7: offset_str = 28; offset_enum = 5; count = 3; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::OutOfLineTest::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::OutOfLineTest>(::enums::detail::OutOfLineTest::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
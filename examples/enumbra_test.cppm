@@ -0,0 +1,2972 @@
+// THIS FILE WAS GENERATED BY A TOOL: https://github.com/Scaless/enumbra
+// It is highly recommended that you not make manual edits to this file,
+// as they will be overwritten when the file is re-generated.
+// Generated by enumbra v0.2.3
+
+// This is where you would put your code license!
+
+module;
+#include <cstdint>
+
+#if !defined(ENUMBRA_REQUIRED_MACROS_VERSION)
+#define ENUMBRA_REQUIRED_MACROS_VERSION 9
+
+// Find out what language version we're using
+// 2024-07-04:MSVC Doesn't officially support C++23 yet
+#if (__cplusplus >= 202302L)
+#define ENUMBRA_CPP_VERSION 23
+#elif ((defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) || (__cplusplus >= 202002L)
+#define ENUMBRA_CPP_VERSION 20
+#elif ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) || (__cplusplus >= 201703L)
+#define ENUMBRA_CPP_VERSION 17
+#else
+#error Headers generated by enumbra require a compiler that supports C++17 or higher.
+#endif
+
+#if defined(__clang__)
+#define ENUMBRA_COMPILER_CLANG
+#elif defined(__GNUG__)
+#define ENUMBRA_COMPILER_GCC
+#elif defined(_MSC_VER)
+#define ENUMBRA_COMPILER_MSVC
+#else
+#define ENUMBRA_COMPILER_UNKNOWN
+#endif
+
+#else // check existing version supported
+#if (ENUMBRA_REQUIRED_MACROS_VERSION + 0) == 0
+#error ENUMBRA_REQUIRED_MACROS_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_REQUIRED_MACROS_VERSION + 0) < 9
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using the same version.
+#elif (ENUMBRA_REQUIRED_MACROS_VERSION + 0) > 9
+#error An included header was generated using an older version of enumbra. Regenerate your headers using the same version.
+#endif // end check existing version supported
+#endif // ENUMBRA_REQUIRED_MACROS_VERSION
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENUMBRA_SIMD_SSE2
+#if defined(__AVX2__)
+#define ENUMBRA_SIMD_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
+export module enumbra_test;
+export import :base;
+
+export namespace enums {
+enum class test_string_parse : int64_t {
+C = -1,
+B = 1,
+F = 341,
+D = 511,
+E = 9223372036854775807,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::test_string_parse> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::test_string_parse> : enumbra::detail::enum_info<int64_t, -1, 9223372036854775807, -1, 5, false, 64, 64, true, 0> { };
+
+namespace enums::detail::test_string_parse {
+inline constexpr ::enums::test_string_parse values_arr[5] =
+{
+::enums::test_string_parse::C,
+::enums::test_string_parse::B,
+::enums::test_string_parse::F,
+::enums::test_string_parse::D,
+::enums::test_string_parse::E,
+};
+inline constexpr const char enum_strings[11] = {
+"C\0"
+"B\0"
+"F\0"
+"D\0"
+"E\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::test_string_parse>() noexcept
+{
+return ::enums::detail::test_string_parse::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_string_parse> enumbra::from_integer<::enums::test_string_parse>(int64_t v) noexcept { 
+for(auto value : values<::enums::test_string_parse>()) {
+if(value == static_cast<::enums::test_string_parse>(v)) { return ::enumbra::optional_value<::enums::test_string_parse>(static_cast<::enums::test_string_parse>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::test_string_parse>(::enums::test_string_parse e) noexcept { 
+for(auto value : values<::enums::test_string_parse>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::test_string_parse>() noexcept { 
+return { "test_string_parse", 17 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::test_string_parse>() noexcept { 
+return { "enums::test_string_parse", 24 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::test_string_parse>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::test_string_parse v) noexcept {
+switch (v) {
+case ::enums::test_string_parse::C: return { &::enums::detail::test_string_parse::enum_strings[0], 1 };
+case ::enums::test_string_parse::B: return { &::enums::detail::test_string_parse::enum_strings[2], 1 };
+case ::enums::test_string_parse::F: return { &::enums::detail::test_string_parse::enum_strings[4], 1 };
+case ::enums::test_string_parse::D: return { &::enums::detail::test_string_parse::enum_strings[6], 1 };
+case ::enums::test_string_parse::E: return { &::enums::detail::test_string_parse::enum_strings[8], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_string_parse> enumbra::from_string<::enums::test_string_parse>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 5;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::test_string_parse::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::test_string_parse>(::enums::detail::test_string_parse::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_string_parse> enumbra::from_string<::enums::test_string_parse>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::test_string_parse>(str, len);
+}
+
+
+export namespace enums {
+enum class Unsigned64Test : uint64_t {
+MIN = 0,
+V_UINT16_MAX = 0xFFFF,
+V_UINT32_MAX = 0xFFFFFFFF,
+MAX = 0xFFFFFFFFFFFFFFFF,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::Unsigned64Test> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::Unsigned64Test> : enumbra::detail::enum_info<uint64_t, 0, 0xFFFFFFFFFFFFFFFF, 0, 4, false, 64, 64, false, 0> { };
+
+namespace enums::detail::Unsigned64Test {
+inline constexpr ::enums::Unsigned64Test values_arr[4] =
+{
+::enums::Unsigned64Test::MIN,
+::enums::Unsigned64Test::V_UINT16_MAX,
+::enums::Unsigned64Test::V_UINT32_MAX,
+::enums::Unsigned64Test::MAX,
+};
+inline constexpr const char enum_strings[35] = {
+"MIN\0"
+"MAX\0"
+"V_UINT16_MAX\0"
+"V_UINT32_MAX\0"
+};
+inline constexpr ::enums::Unsigned64Test enum_string_values[4] = {
+::enums::Unsigned64Test::MIN,
+::enums::Unsigned64Test::MAX,
+::enums::Unsigned64Test::V_UINT16_MAX,
+::enums::Unsigned64Test::V_UINT32_MAX,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::Unsigned64Test>() noexcept
+{
+return ::enums::detail::Unsigned64Test::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Unsigned64Test> enumbra::from_integer<::enums::Unsigned64Test>(uint64_t v) noexcept { 
+for(auto value : values<::enums::Unsigned64Test>()) {
+if(value == static_cast<::enums::Unsigned64Test>(v)) { return ::enumbra::optional_value<::enums::Unsigned64Test>(static_cast<::enums::Unsigned64Test>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::Unsigned64Test>(::enums::Unsigned64Test e) noexcept { 
+for(auto value : values<::enums::Unsigned64Test>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::Unsigned64Test>() noexcept { 
+return { "Unsigned64Test", 14 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::Unsigned64Test>() noexcept { 
+return { "enums::Unsigned64Test", 21 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::Unsigned64Test>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::Unsigned64Test v) noexcept {
+switch (v) {
+case ::enums::Unsigned64Test::MIN: return { &::enums::detail::Unsigned64Test::enum_strings[0], 3 };
+case ::enums::Unsigned64Test::MAX: return { &::enums::detail::Unsigned64Test::enum_strings[4], 3 };
+case ::enums::Unsigned64Test::V_UINT16_MAX: return { &::enums::detail::Unsigned64Test::enum_strings[8], 12 };
+case ::enums::Unsigned64Test::V_UINT32_MAX: return { &::enums::detail::Unsigned64Test::enum_strings[21], 12 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Unsigned64Test> enumbra::from_string<::enums::Unsigned64Test>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 2; break;
+case 12: offset_str = 8; offset_enum = 2; count = 2; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::Unsigned64Test::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::Unsigned64Test>(::enums::detail::Unsigned64Test::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Unsigned64Test> enumbra::from_string<::enums::Unsigned64Test>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::Unsigned64Test>(str, len);
+}
+
+
+export namespace enums {
+enum class Signed64Test : int64_t {
+MIN = (-9223372036854775807 - 1),
+NEG_ONE = -1,
+MAX = 9223372036854775807,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::Signed64Test> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::Signed64Test> : enumbra::detail::enum_info<int64_t, (-9223372036854775807 - 1), 9223372036854775807, (-9223372036854775807 - 1), 3, false, 64, 64, true, 0> { };
+
+namespace enums::detail::Signed64Test {
+inline constexpr ::enums::Signed64Test values_arr[3] =
+{
+::enums::Signed64Test::MIN,
+::enums::Signed64Test::NEG_ONE,
+::enums::Signed64Test::MAX,
+};
+inline constexpr const char enum_strings[17] = {
+"MIN\0"
+"MAX\0"
+"NEG_ONE\0"
+};
+inline constexpr ::enums::Signed64Test enum_string_values[3] = {
+::enums::Signed64Test::MIN,
+::enums::Signed64Test::MAX,
+::enums::Signed64Test::NEG_ONE,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::Signed64Test>() noexcept
+{
+return ::enums::detail::Signed64Test::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed64Test> enumbra::from_integer<::enums::Signed64Test>(int64_t v) noexcept { 
+for(auto value : values<::enums::Signed64Test>()) {
+if(value == static_cast<::enums::Signed64Test>(v)) { return ::enumbra::optional_value<::enums::Signed64Test>(static_cast<::enums::Signed64Test>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::Signed64Test>(::enums::Signed64Test e) noexcept { 
+for(auto value : values<::enums::Signed64Test>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::Signed64Test>() noexcept { 
+return { "Signed64Test", 12 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::Signed64Test>() noexcept { 
+return { "enums::Signed64Test", 19 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::Signed64Test>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::Signed64Test v) noexcept {
+switch (v) {
+case ::enums::Signed64Test::MIN: return { &::enums::detail::Signed64Test::enum_strings[0], 3 };
+case ::enums::Signed64Test::MAX: return { &::enums::detail::Signed64Test::enum_strings[4], 3 };
+case ::enums::Signed64Test::NEG_ONE: return { &::enums::detail::Signed64Test::enum_strings[8], 7 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed64Test> enumbra::from_string<::enums::Signed64Test>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 2; break;
+case 7: offset_str = 8; offset_enum = 2; count = 1; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::Signed64Test::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::Signed64Test>(::enums::detail::Signed64Test::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed64Test> enumbra::from_string<::enums::Signed64Test>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::Signed64Test>(str, len);
+}
+
+
+export namespace enums {
+enum class Signed32Test : int32_t {
+MIN = (-2147483647 - 1),
+NEG_ONE = -1,
+MAX = 2147483647,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::Signed32Test> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::Signed32Test> : enumbra::detail::enum_info<int32_t, (-2147483647 - 1), 2147483647, (-2147483647 - 1), 3, false, 32, 32, true, 0> { };
+
+namespace enums::detail::Signed32Test {
+inline constexpr ::enums::Signed32Test values_arr[3] =
+{
+::enums::Signed32Test::MIN,
+::enums::Signed32Test::NEG_ONE,
+::enums::Signed32Test::MAX,
+};
+inline constexpr const char enum_strings[17] = {
+"MIN\0"
+"MAX\0"
+"NEG_ONE\0"
+};
+inline constexpr ::enums::Signed32Test enum_string_values[3] = {
+::enums::Signed32Test::MIN,
+::enums::Signed32Test::MAX,
+::enums::Signed32Test::NEG_ONE,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::Signed32Test>() noexcept
+{
+return ::enums::detail::Signed32Test::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed32Test> enumbra::from_integer<::enums::Signed32Test>(int32_t v) noexcept { 
+for(auto value : values<::enums::Signed32Test>()) {
+if(value == static_cast<::enums::Signed32Test>(v)) { return ::enumbra::optional_value<::enums::Signed32Test>(static_cast<::enums::Signed32Test>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::Signed32Test>(::enums::Signed32Test e) noexcept { 
+for(auto value : values<::enums::Signed32Test>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::Signed32Test>() noexcept { 
+return { "Signed32Test", 12 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::Signed32Test>() noexcept { 
+return { "enums::Signed32Test", 19 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::Signed32Test>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::Signed32Test v) noexcept {
+switch (v) {
+case ::enums::Signed32Test::MIN: return { &::enums::detail::Signed32Test::enum_strings[0], 3 };
+case ::enums::Signed32Test::MAX: return { &::enums::detail::Signed32Test::enum_strings[4], 3 };
+case ::enums::Signed32Test::NEG_ONE: return { &::enums::detail::Signed32Test::enum_strings[8], 7 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed32Test> enumbra::from_string<::enums::Signed32Test>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 2; break;
+case 7: offset_str = 8; offset_enum = 2; count = 1; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::Signed32Test::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::Signed32Test>(::enums::detail::Signed32Test::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed32Test> enumbra::from_string<::enums::Signed32Test>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::Signed32Test>(str, len);
+}
+
+
+export namespace enums {
+enum class Signed16Test : int16_t {
+MIN = (-32767 - 1),
+NEG_ONE = -1,
+MAX = 32767,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::Signed16Test> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::Signed16Test> : enumbra::detail::enum_info<int16_t, (-32767 - 1), 32767, (-32767 - 1), 3, false, 16, 16, true, 0> { };
+
+namespace enums::detail::Signed16Test {
+inline constexpr ::enums::Signed16Test values_arr[3] =
+{
+::enums::Signed16Test::MIN,
+::enums::Signed16Test::NEG_ONE,
+::enums::Signed16Test::MAX,
+};
+inline constexpr const char enum_strings[17] = {
+"MIN\0"
+"MAX\0"
+"NEG_ONE\0"
+};
+inline constexpr ::enums::Signed16Test enum_string_values[3] = {
+::enums::Signed16Test::MIN,
+::enums::Signed16Test::MAX,
+::enums::Signed16Test::NEG_ONE,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::Signed16Test>() noexcept
+{
+return ::enums::detail::Signed16Test::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed16Test> enumbra::from_integer<::enums::Signed16Test>(int16_t v) noexcept { 
+for(auto value : values<::enums::Signed16Test>()) {
+if(value == static_cast<::enums::Signed16Test>(v)) { return ::enumbra::optional_value<::enums::Signed16Test>(static_cast<::enums::Signed16Test>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::Signed16Test>(::enums::Signed16Test e) noexcept { 
+for(auto value : values<::enums::Signed16Test>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::Signed16Test>() noexcept { 
+return { "Signed16Test", 12 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::Signed16Test>() noexcept { 
+return { "enums::Signed16Test", 19 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::Signed16Test>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::Signed16Test v) noexcept {
+switch (v) {
+case ::enums::Signed16Test::MIN: return { &::enums::detail::Signed16Test::enum_strings[0], 3 };
+case ::enums::Signed16Test::MAX: return { &::enums::detail::Signed16Test::enum_strings[4], 3 };
+case ::enums::Signed16Test::NEG_ONE: return { &::enums::detail::Signed16Test::enum_strings[8], 7 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed16Test> enumbra::from_string<::enums::Signed16Test>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 2; break;
+case 7: offset_str = 8; offset_enum = 2; count = 1; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::Signed16Test::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::Signed16Test>(::enums::detail::Signed16Test::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed16Test> enumbra::from_string<::enums::Signed16Test>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::Signed16Test>(str, len);
+}
+
+
+export namespace enums {
+enum class Signed8Test : int8_t {
+V_INT_MIN = (-127 - 1),
+V_NEG_ONE = -1,
+V_INT_MAX = 127,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::Signed8Test> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::Signed8Test> : enumbra::detail::enum_info<int8_t, (-127 - 1), 127, (-127 - 1), 3, false, 8, 8, true, 0> { };
+
+namespace enums::detail::Signed8Test {
+inline constexpr ::enums::Signed8Test values_arr[3] =
+{
+::enums::Signed8Test::V_INT_MIN,
+::enums::Signed8Test::V_NEG_ONE,
+::enums::Signed8Test::V_INT_MAX,
+};
+inline constexpr const char enum_strings[31] = {
+"V_INT_MIN\0"
+"V_NEG_ONE\0"
+"V_INT_MAX\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::Signed8Test>() noexcept
+{
+return ::enums::detail::Signed8Test::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed8Test> enumbra::from_integer<::enums::Signed8Test>(int8_t v) noexcept { 
+for(auto value : values<::enums::Signed8Test>()) {
+if(value == static_cast<::enums::Signed8Test>(v)) { return ::enumbra::optional_value<::enums::Signed8Test>(static_cast<::enums::Signed8Test>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::Signed8Test>(::enums::Signed8Test e) noexcept { 
+for(auto value : values<::enums::Signed8Test>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::Signed8Test>() noexcept { 
+return { "Signed8Test", 11 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::Signed8Test>() noexcept { 
+return { "enums::Signed8Test", 18 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::Signed8Test>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::Signed8Test v) noexcept {
+switch (v) {
+case ::enums::Signed8Test::V_INT_MIN: return { &::enums::detail::Signed8Test::enum_strings[0], 9 };
+case ::enums::Signed8Test::V_NEG_ONE: return { &::enums::detail::Signed8Test::enum_strings[10], 9 };
+case ::enums::Signed8Test::V_INT_MAX: return { &::enums::detail::Signed8Test::enum_strings[20], 9 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed8Test> enumbra::from_string<::enums::Signed8Test>(const char* str, int len) noexcept {
+if(len != 9) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 3;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<9>(::enums::detail::Signed8Test::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::Signed8Test>(::enums::detail::Signed8Test::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Signed8Test> enumbra::from_string<::enums::Signed8Test>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::Signed8Test>(str, len);
+}
+
+
+export namespace enums {
+enum class test_value : int32_t {
+A = 0,
+B = 1,
+C = 2,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::test_value> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::test_value> : enumbra::detail::enum_info<int32_t, 0, 2, 0, 3, true, 3, 2, true, -1> { };
+
+namespace enums::detail::test_value {
+inline constexpr ::enums::test_value values_arr[3] =
+{
+::enums::test_value::A,
+::enums::test_value::B,
+::enums::test_value::C,
+};
+inline constexpr const char enum_strings[7] = {
+"A\0"
+"B\0"
+"C\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::test_value>() noexcept
+{
+return ::enums::detail::test_value::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_value> enumbra::from_integer<::enums::test_value>(int32_t v) noexcept { 
+if((0 <= v) && (v <= 2)) { return ::enumbra::optional_value<::enums::test_value>(static_cast<::enums::test_value>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::test_value>(::enums::test_value e) noexcept { 
+return (0 <= static_cast<int32_t>(e)) && (static_cast<int32_t>(e) <= 2);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::test_value>() noexcept { 
+return { "test_value", 10 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::test_value>() noexcept { 
+return { "enums::test_value", 17 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::test_value>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::test_value v) noexcept {
+switch (v) {
+case ::enums::test_value::A: return { &::enums::detail::test_value::enum_strings[0], 1 };
+case ::enums::test_value::B: return { &::enums::detail::test_value::enum_strings[2], 1 };
+case ::enums::test_value::C: return { &::enums::detail::test_value::enum_strings[4], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_value> enumbra::from_string<::enums::test_value>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 3;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::test_value::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::test_value>(::enums::detail::test_value::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_value> enumbra::from_string<::enums::test_value>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::test_value>(str, len);
+}
+
+
+export namespace enums {
+enum class HexDiagonal : uint8_t {
+NORTH = 0,
+NORTH_EAST = 1,
+SOUTH_EAST = 2,
+SOUTH = 3,
+SOUTH_WEST = 4,
+NORTH_WEST = 5,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::HexDiagonal> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::HexDiagonal> : enumbra::detail::enum_info<uint8_t, 0, 5, 0, 6, true, 3, 3, true, 255> { };
+
+namespace enums::detail::HexDiagonal {
+inline constexpr ::enums::HexDiagonal values_arr[6] =
+{
+::enums::HexDiagonal::NORTH,
+::enums::HexDiagonal::NORTH_EAST,
+::enums::HexDiagonal::SOUTH_EAST,
+::enums::HexDiagonal::SOUTH,
+::enums::HexDiagonal::SOUTH_WEST,
+::enums::HexDiagonal::NORTH_WEST,
+};
+inline constexpr const char enum_strings[57] = {
+"NORTH\0"
+"SOUTH\0"
+"NORTH_EAST\0"
+"SOUTH_EAST\0"
+"SOUTH_WEST\0"
+"NORTH_WEST\0"
+};
+inline constexpr ::enums::HexDiagonal enum_string_values[6] = {
+::enums::HexDiagonal::NORTH,
+::enums::HexDiagonal::SOUTH,
+::enums::HexDiagonal::NORTH_EAST,
+::enums::HexDiagonal::SOUTH_EAST,
+::enums::HexDiagonal::SOUTH_WEST,
+::enums::HexDiagonal::NORTH_WEST,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::HexDiagonal>() noexcept
+{
+return ::enums::detail::HexDiagonal::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::HexDiagonal> enumbra::from_integer<::enums::HexDiagonal>(uint8_t v) noexcept { 
+if(v <= 5) { return ::enumbra::optional_value<::enums::HexDiagonal>(static_cast<::enums::HexDiagonal>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::HexDiagonal>(::enums::HexDiagonal e) noexcept { 
+return static_cast<uint8_t>(e) <= 5;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::HexDiagonal>() noexcept { 
+return { "HexDiagonal", 11 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::HexDiagonal>() noexcept { 
+return { "enums::HexDiagonal", 18 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::HexDiagonal>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::HexDiagonal v) noexcept {
+switch (v) {
+case ::enums::HexDiagonal::NORTH: return { &::enums::detail::HexDiagonal::enum_strings[0], 5 };
+case ::enums::HexDiagonal::SOUTH: return { &::enums::detail::HexDiagonal::enum_strings[6], 5 };
+case ::enums::HexDiagonal::NORTH_EAST: return { &::enums::detail::HexDiagonal::enum_strings[12], 10 };
+case ::enums::HexDiagonal::SOUTH_EAST: return { &::enums::detail::HexDiagonal::enum_strings[23], 10 };
+case ::enums::HexDiagonal::SOUTH_WEST: return { &::enums::detail::HexDiagonal::enum_strings[34], 10 };
+case ::enums::HexDiagonal::NORTH_WEST: return { &::enums::detail::HexDiagonal::enum_strings[45], 10 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::HexDiagonal> enumbra::from_string<::enums::HexDiagonal>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 5: offset_str = 0; offset_enum = 0; count = 2; break;
+case 10: offset_str = 12; offset_enum = 2; count = 4; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::HexDiagonal::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::HexDiagonal>(::enums::detail::HexDiagonal::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::HexDiagonal> enumbra::from_string<::enums::HexDiagonal>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::HexDiagonal>(str, len);
+}
+
+
+export namespace enums {
+enum class NegativeTest1 : int8_t {
+A = -2,
+B = -1,
+C = 0,
+D = 1,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::NegativeTest1> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::NegativeTest1> : enumbra::detail::enum_info<int8_t, -2, 1, -2, 4, true, 2, 2, false, 0> { };
+
+namespace enums::detail::NegativeTest1 {
+inline constexpr ::enums::NegativeTest1 values_arr[4] =
+{
+::enums::NegativeTest1::A,
+::enums::NegativeTest1::B,
+::enums::NegativeTest1::C,
+::enums::NegativeTest1::D,
+};
+inline constexpr const char enum_strings[9] = {
+"A\0"
+"B\0"
+"C\0"
+"D\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::NegativeTest1>() noexcept
+{
+return ::enums::detail::NegativeTest1::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest1> enumbra::from_integer<::enums::NegativeTest1>(int8_t v) noexcept { 
+if((-2 <= v) && (v <= 1)) { return ::enumbra::optional_value<::enums::NegativeTest1>(static_cast<::enums::NegativeTest1>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::NegativeTest1>(::enums::NegativeTest1 e) noexcept { 
+return (-2 <= static_cast<int8_t>(e)) && (static_cast<int8_t>(e) <= 1);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::NegativeTest1>() noexcept { 
+return { "NegativeTest1", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::NegativeTest1>() noexcept { 
+return { "enums::NegativeTest1", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::NegativeTest1>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::NegativeTest1 v) noexcept {
+switch (v) {
+case ::enums::NegativeTest1::A: return { &::enums::detail::NegativeTest1::enum_strings[0], 1 };
+case ::enums::NegativeTest1::B: return { &::enums::detail::NegativeTest1::enum_strings[2], 1 };
+case ::enums::NegativeTest1::C: return { &::enums::detail::NegativeTest1::enum_strings[4], 1 };
+case ::enums::NegativeTest1::D: return { &::enums::detail::NegativeTest1::enum_strings[6], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest1> enumbra::from_string<::enums::NegativeTest1>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 4;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::NegativeTest1::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::NegativeTest1>(::enums::detail::NegativeTest1::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest1> enumbra::from_string<::enums::NegativeTest1>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::NegativeTest1>(str, len);
+}
+
+
+export namespace enums {
+enum class NegativeTest2 : int8_t {
+A = -3,
+B = -2,
+C = -1,
+D = 0,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::NegativeTest2> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::NegativeTest2> : enumbra::detail::enum_info<int8_t, -3, 0, -3, 4, true, 3, 2, false, 0> { };
+
+namespace enums::detail::NegativeTest2 {
+inline constexpr ::enums::NegativeTest2 values_arr[4] =
+{
+::enums::NegativeTest2::A,
+::enums::NegativeTest2::B,
+::enums::NegativeTest2::C,
+::enums::NegativeTest2::D,
+};
+inline constexpr const char enum_strings[9] = {
+"A\0"
+"B\0"
+"C\0"
+"D\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::NegativeTest2>() noexcept
+{
+return ::enums::detail::NegativeTest2::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest2> enumbra::from_integer<::enums::NegativeTest2>(int8_t v) noexcept { 
+if((-3 <= v) && (v <= 0)) { return ::enumbra::optional_value<::enums::NegativeTest2>(static_cast<::enums::NegativeTest2>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::NegativeTest2>(::enums::NegativeTest2 e) noexcept { 
+return (-3 <= static_cast<int8_t>(e)) && (static_cast<int8_t>(e) <= 0);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::NegativeTest2>() noexcept { 
+return { "NegativeTest2", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::NegativeTest2>() noexcept { 
+return { "enums::NegativeTest2", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::NegativeTest2>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::NegativeTest2 v) noexcept {
+switch (v) {
+case ::enums::NegativeTest2::A: return { &::enums::detail::NegativeTest2::enum_strings[0], 1 };
+case ::enums::NegativeTest2::B: return { &::enums::detail::NegativeTest2::enum_strings[2], 1 };
+case ::enums::NegativeTest2::C: return { &::enums::detail::NegativeTest2::enum_strings[4], 1 };
+case ::enums::NegativeTest2::D: return { &::enums::detail::NegativeTest2::enum_strings[6], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest2> enumbra::from_string<::enums::NegativeTest2>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 4;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::NegativeTest2::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::NegativeTest2>(::enums::detail::NegativeTest2::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest2> enumbra::from_string<::enums::NegativeTest2>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::NegativeTest2>(str, len);
+}
+
+
+export namespace enums {
+enum class NegativeTest3 : int8_t {
+A = -3,
+B = 4,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::NegativeTest3> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::NegativeTest3> : enumbra::detail::enum_info<int8_t, -3, 4, -3, 2, false, 4, 3, true, 0> { };
+
+namespace enums::detail::NegativeTest3 {
+inline constexpr ::enums::NegativeTest3 values_arr[2] =
+{
+::enums::NegativeTest3::A,
+::enums::NegativeTest3::B,
+};
+inline constexpr const char enum_strings[5] = {
+"A\0"
+"B\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::NegativeTest3>() noexcept
+{
+return ::enums::detail::NegativeTest3::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest3> enumbra::from_integer<::enums::NegativeTest3>(int8_t v) noexcept { 
+for(auto value : values<::enums::NegativeTest3>()) {
+if(value == static_cast<::enums::NegativeTest3>(v)) { return ::enumbra::optional_value<::enums::NegativeTest3>(static_cast<::enums::NegativeTest3>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::NegativeTest3>(::enums::NegativeTest3 e) noexcept { 
+for(auto value : values<::enums::NegativeTest3>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::NegativeTest3>() noexcept { 
+return { "NegativeTest3", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::NegativeTest3>() noexcept { 
+return { "enums::NegativeTest3", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::NegativeTest3>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::NegativeTest3 v) noexcept {
+switch (v) {
+case ::enums::NegativeTest3::A: return { &::enums::detail::NegativeTest3::enum_strings[0], 1 };
+case ::enums::NegativeTest3::B: return { &::enums::detail::NegativeTest3::enum_strings[2], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest3> enumbra::from_string<::enums::NegativeTest3>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 2;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::NegativeTest3::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::NegativeTest3>(::enums::detail::NegativeTest3::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest3> enumbra::from_string<::enums::NegativeTest3>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::NegativeTest3>(str, len);
+}
+
+
+export namespace enums {
+enum class NegativeTest4 : int8_t {
+A = -4,
+B = 3,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::NegativeTest4> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::NegativeTest4> : enumbra::detail::enum_info<int8_t, -4, 3, -4, 2, false, 3, 3, true, 0> { };
+
+namespace enums::detail::NegativeTest4 {
+inline constexpr ::enums::NegativeTest4 values_arr[2] =
+{
+::enums::NegativeTest4::A,
+::enums::NegativeTest4::B,
+};
+inline constexpr const char enum_strings[5] = {
+"A\0"
+"B\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::NegativeTest4>() noexcept
+{
+return ::enums::detail::NegativeTest4::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest4> enumbra::from_integer<::enums::NegativeTest4>(int8_t v) noexcept { 
+for(auto value : values<::enums::NegativeTest4>()) {
+if(value == static_cast<::enums::NegativeTest4>(v)) { return ::enumbra::optional_value<::enums::NegativeTest4>(static_cast<::enums::NegativeTest4>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::NegativeTest4>(::enums::NegativeTest4 e) noexcept { 
+for(auto value : values<::enums::NegativeTest4>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::NegativeTest4>() noexcept { 
+return { "NegativeTest4", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::NegativeTest4>() noexcept { 
+return { "enums::NegativeTest4", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::NegativeTest4>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::NegativeTest4 v) noexcept {
+switch (v) {
+case ::enums::NegativeTest4::A: return { &::enums::detail::NegativeTest4::enum_strings[0], 1 };
+case ::enums::NegativeTest4::B: return { &::enums::detail::NegativeTest4::enum_strings[2], 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest4> enumbra::from_string<::enums::NegativeTest4>(const char* str, int len) noexcept {
+if(len != 1) { return {}; }
+constexpr int offset_str = 0;
+constexpr int offset_enum = 0;
+constexpr int count = 2;
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_fixed_size<1>(::enums::detail::NegativeTest4::enum_strings + offset_str + (i * (len + 1)), str)) {
+return ::enumbra::optional_value<::enums::NegativeTest4>(::enums::detail::NegativeTest4::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::NegativeTest4> enumbra::from_string<::enums::NegativeTest4>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::NegativeTest4>(str, len);
+}
+
+
+export namespace enums {
+enum class EmptyTest1Unsigned : uint8_t {
+A = 0,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::EmptyTest1Unsigned> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::EmptyTest1Unsigned> : enumbra::detail::enum_info<uint8_t, 0, 0, 0, 1, true, 1, 0, true, 255> { };
+
+namespace enums::detail::EmptyTest1Unsigned {
+inline constexpr ::enums::EmptyTest1Unsigned values_arr[1] =
+{
+::enums::EmptyTest1Unsigned::A,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::EmptyTest1Unsigned>() noexcept
+{
+return ::enums::detail::EmptyTest1Unsigned::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Unsigned> enumbra::from_integer<::enums::EmptyTest1Unsigned>(uint8_t v) noexcept { 
+if(0 == v) { return ::enumbra::optional_value<::enums::EmptyTest1Unsigned>(static_cast<::enums::EmptyTest1Unsigned>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::EmptyTest1Unsigned>(::enums::EmptyTest1Unsigned e) noexcept { 
+return 0 == static_cast<uint8_t>(e);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::EmptyTest1Unsigned>() noexcept { 
+return { "EmptyTest1Unsigned", 18 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::EmptyTest1Unsigned>() noexcept { 
+return { "enums::EmptyTest1Unsigned", 25 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::EmptyTest1Unsigned>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::EmptyTest1Unsigned v) noexcept {
+switch (v) {
+case ::enums::EmptyTest1Unsigned::A: return { "A", 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Unsigned> enumbra::from_string<::enums::EmptyTest1Unsigned>(const char* str, int len) noexcept {
+if ((len == 1) && ::enumbra::detail::streq_fixed_size<1>("A", str)) {
+return ::enumbra::optional_value<::enums::EmptyTest1Unsigned>(::enums::EmptyTest1Unsigned::A);
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Unsigned> enumbra::from_string<::enums::EmptyTest1Unsigned>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::EmptyTest1Unsigned>(str, len);
+}
+
+
+export namespace enums {
+enum class EmptyTest1Signed : int8_t {
+A = 0,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::EmptyTest1Signed> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::EmptyTest1Signed> : enumbra::detail::enum_info<int8_t, 0, 0, 0, 1, true, 1, 0, true, -1> { };
+
+namespace enums::detail::EmptyTest1Signed {
+inline constexpr ::enums::EmptyTest1Signed values_arr[1] =
+{
+::enums::EmptyTest1Signed::A,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::EmptyTest1Signed>() noexcept
+{
+return ::enums::detail::EmptyTest1Signed::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Signed> enumbra::from_integer<::enums::EmptyTest1Signed>(int8_t v) noexcept { 
+if(0 == v) { return ::enumbra::optional_value<::enums::EmptyTest1Signed>(static_cast<::enums::EmptyTest1Signed>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::EmptyTest1Signed>(::enums::EmptyTest1Signed e) noexcept { 
+return 0 == static_cast<int8_t>(e);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::EmptyTest1Signed>() noexcept { 
+return { "EmptyTest1Signed", 16 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::EmptyTest1Signed>() noexcept { 
+return { "enums::EmptyTest1Signed", 23 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::EmptyTest1Signed>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::EmptyTest1Signed v) noexcept {
+switch (v) {
+case ::enums::EmptyTest1Signed::A: return { "A", 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Signed> enumbra::from_string<::enums::EmptyTest1Signed>(const char* str, int len) noexcept {
+if ((len == 1) && ::enumbra::detail::streq_fixed_size<1>("A", str)) {
+return ::enumbra::optional_value<::enums::EmptyTest1Signed>(::enums::EmptyTest1Signed::A);
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::EmptyTest1Signed> enumbra::from_string<::enums::EmptyTest1Signed>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::EmptyTest1Signed>(str, len);
+}
+
+
+export namespace enums {
+enum class SingleTest1Unsigned : uint8_t {
+A = 4,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::SingleTest1Unsigned> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::SingleTest1Unsigned> : enumbra::detail::enum_info<uint8_t, 4, 4, 4, 1, true, 3, 0, true, 0> { };
+
+namespace enums::detail::SingleTest1Unsigned {
+inline constexpr ::enums::SingleTest1Unsigned values_arr[1] =
+{
+::enums::SingleTest1Unsigned::A,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::SingleTest1Unsigned>() noexcept
+{
+return ::enums::detail::SingleTest1Unsigned::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Unsigned> enumbra::from_integer<::enums::SingleTest1Unsigned>(uint8_t v) noexcept { 
+if(4 == v) { return ::enumbra::optional_value<::enums::SingleTest1Unsigned>(static_cast<::enums::SingleTest1Unsigned>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::SingleTest1Unsigned>(::enums::SingleTest1Unsigned e) noexcept { 
+return 4 == static_cast<uint8_t>(e);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::SingleTest1Unsigned>() noexcept { 
+return { "SingleTest1Unsigned", 19 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::SingleTest1Unsigned>() noexcept { 
+return { "enums::SingleTest1Unsigned", 26 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::SingleTest1Unsigned>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::SingleTest1Unsigned v) noexcept {
+switch (v) {
+case ::enums::SingleTest1Unsigned::A: return { "A", 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Unsigned> enumbra::from_string<::enums::SingleTest1Unsigned>(const char* str, int len) noexcept {
+if ((len == 1) && ::enumbra::detail::streq_fixed_size<1>("A", str)) {
+return ::enumbra::optional_value<::enums::SingleTest1Unsigned>(::enums::SingleTest1Unsigned::A);
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Unsigned> enumbra::from_string<::enums::SingleTest1Unsigned>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::SingleTest1Unsigned>(str, len);
+}
+
+
+export namespace enums {
+enum class SingleTest1Signed : int8_t {
+A = 4,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::SingleTest1Signed> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::SingleTest1Signed> : enumbra::detail::enum_info<int8_t, 4, 4, 4, 1, true, 4, 0, true, 0> { };
+
+namespace enums::detail::SingleTest1Signed {
+inline constexpr ::enums::SingleTest1Signed values_arr[1] =
+{
+::enums::SingleTest1Signed::A,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::SingleTest1Signed>() noexcept
+{
+return ::enums::detail::SingleTest1Signed::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Signed> enumbra::from_integer<::enums::SingleTest1Signed>(int8_t v) noexcept { 
+if(4 == v) { return ::enumbra::optional_value<::enums::SingleTest1Signed>(static_cast<::enums::SingleTest1Signed>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::SingleTest1Signed>(::enums::SingleTest1Signed e) noexcept { 
+return 4 == static_cast<int8_t>(e);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::SingleTest1Signed>() noexcept { 
+return { "SingleTest1Signed", 17 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::SingleTest1Signed>() noexcept { 
+return { "enums::SingleTest1Signed", 24 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::SingleTest1Signed>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::SingleTest1Signed v) noexcept {
+switch (v) {
+case ::enums::SingleTest1Signed::A: return { "A", 1 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Signed> enumbra::from_string<::enums::SingleTest1Signed>(const char* str, int len) noexcept {
+if ((len == 1) && ::enumbra::detail::streq_fixed_size<1>("A", str)) {
+return ::enumbra::optional_value<::enums::SingleTest1Signed>(::enums::SingleTest1Signed::A);
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::SingleTest1Signed> enumbra::from_string<::enums::SingleTest1Signed>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::SingleTest1Signed>(str, len);
+}
+
+
+export namespace enums {
+enum class errc : int32_t {
+operation_not_permitted = 1,
+no_such_file_or_directory = 2,
+no_such_process = 3,
+interrupted = 4,
+io_error = 5,
+no_such_device_or_address = 6,
+argument_list_too_long = 7,
+executable_format_error = 8,
+bad_file_descriptor = 9,
+no_child_process = 10,
+resource_unavailable_try_again = 11,
+not_enough_memory = 12,
+permission_denied = 13,
+bad_address = 14,
+device_or_resource_busy = 16,
+file_exists = 17,
+cross_device_link = 18,
+no_such_device = 19,
+not_a_directory = 20,
+is_a_directory = 21,
+invalid_argument = 22,
+too_many_files_open_in_system = 23,
+too_many_files_open = 24,
+inappropriate_io_control_operation = 25,
+file_too_large = 27,
+no_space_on_device = 28,
+invalid_seek = 29,
+read_only_file_system = 30,
+too_many_links = 31,
+broken_pipe = 32,
+argument_out_of_domain = 33,
+result_out_of_range = 34,
+resource_deadlock_would_occur = 36,
+filename_too_long = 38,
+no_lock_available = 39,
+function_not_supported = 40,
+directory_not_empty = 41,
+illegal_byte_sequence = 42,
+address_in_use = 100,
+address_not_available = 101,
+address_family_not_supported = 102,
+connection_already_in_progress = 103,
+bad_message = 104,
+operation_canceled = 105,
+connection_aborted = 106,
+connection_refused = 107,
+connection_reset = 108,
+destination_address_required = 109,
+host_unreachable = 110,
+identifier_removed = 111,
+operation_in_progress = 112,
+already_connected = 113,
+too_many_symbolic_link_levels = 114,
+message_size = 115,
+network_down = 116,
+network_reset = 117,
+network_unreachable = 118,
+no_buffer_space = 119,
+no_message_available = 120,
+no_link = 121,
+no_message = 122,
+no_protocol_option = 123,
+no_stream_resources = 124,
+not_a_stream = 125,
+not_connected = 126,
+state_not_recoverable = 127,
+not_a_socket = 128,
+not_supported = 129,
+operation_not_supported = 130,
+value_too_large = 132,
+owner_dead = 133,
+protocol_error = 134,
+protocol_not_supported = 135,
+wrong_protocol_type = 136,
+stream_timeout = 137,
+timed_out = 138,
+text_file_busy = 139,
+operation_would_block = 140,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::errc> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::errc> : enumbra::detail::enum_info<int32_t, 1, 140, 1, 78, false, 9, 8, true, 0> { };
+
+namespace enums::detail::errc {
+inline constexpr ::enums::errc values_arr[78] =
+{
+::enums::errc::operation_not_permitted,
+::enums::errc::no_such_file_or_directory,
+::enums::errc::no_such_process,
+::enums::errc::interrupted,
+::enums::errc::io_error,
+::enums::errc::no_such_device_or_address,
+::enums::errc::argument_list_too_long,
+::enums::errc::executable_format_error,
+::enums::errc::bad_file_descriptor,
+::enums::errc::no_child_process,
+::enums::errc::resource_unavailable_try_again,
+::enums::errc::not_enough_memory,
+::enums::errc::permission_denied,
+::enums::errc::bad_address,
+::enums::errc::device_or_resource_busy,
+::enums::errc::file_exists,
+::enums::errc::cross_device_link,
+::enums::errc::no_such_device,
+::enums::errc::not_a_directory,
+::enums::errc::is_a_directory,
+::enums::errc::invalid_argument,
+::enums::errc::too_many_files_open_in_system,
+::enums::errc::too_many_files_open,
+::enums::errc::inappropriate_io_control_operation,
+::enums::errc::file_too_large,
+::enums::errc::no_space_on_device,
+::enums::errc::invalid_seek,
+::enums::errc::read_only_file_system,
+::enums::errc::too_many_links,
+::enums::errc::broken_pipe,
+::enums::errc::argument_out_of_domain,
+::enums::errc::result_out_of_range,
+::enums::errc::resource_deadlock_would_occur,
+::enums::errc::filename_too_long,
+::enums::errc::no_lock_available,
+::enums::errc::function_not_supported,
+::enums::errc::directory_not_empty,
+::enums::errc::illegal_byte_sequence,
+::enums::errc::address_in_use,
+::enums::errc::address_not_available,
+::enums::errc::address_family_not_supported,
+::enums::errc::connection_already_in_progress,
+::enums::errc::bad_message,
+::enums::errc::operation_canceled,
+::enums::errc::connection_aborted,
+::enums::errc::connection_refused,
+::enums::errc::connection_reset,
+::enums::errc::destination_address_required,
+::enums::errc::host_unreachable,
+::enums::errc::identifier_removed,
+::enums::errc::operation_in_progress,
+::enums::errc::already_connected,
+::enums::errc::too_many_symbolic_link_levels,
+::enums::errc::message_size,
+::enums::errc::network_down,
+::enums::errc::network_reset,
+::enums::errc::network_unreachable,
+::enums::errc::no_buffer_space,
+::enums::errc::no_message_available,
+::enums::errc::no_link,
+::enums::errc::no_message,
+::enums::errc::no_protocol_option,
+::enums::errc::no_stream_resources,
+::enums::errc::not_a_stream,
+::enums::errc::not_connected,
+::enums::errc::state_not_recoverable,
+::enums::errc::not_a_socket,
+::enums::errc::not_supported,
+::enums::errc::operation_not_supported,
+::enums::errc::value_too_large,
+::enums::errc::owner_dead,
+::enums::errc::protocol_error,
+::enums::errc::protocol_not_supported,
+::enums::errc::wrong_protocol_type,
+::enums::errc::stream_timeout,
+::enums::errc::timed_out,
+::enums::errc::text_file_busy,
+::enums::errc::operation_would_block,
+};
+inline constexpr const char enum_strings[1469] = {
+"no_link\0"
+"io_error\0"
+"timed_out\0"
+"no_message\0"
+"owner_dead\0"
+"interrupted\0"
+"bad_address\0"
+"file_exists\0"
+"broken_pipe\0"
+"bad_message\0"
+"invalid_seek\0"
+"message_size\0"
+"network_down\0"
+"not_a_stream\0"
+"not_a_socket\0"
+"network_reset\0"
+"not_connected\0"
+"not_supported\0"
+"no_such_device\0"
+"is_a_directory\0"
+"file_too_large\0"
+"too_many_links\0"
+"address_in_use\0"
+"protocol_error\0"
+"stream_timeout\0"
+"text_file_busy\0"
+"no_such_process\0"
+"not_a_directory\0"
+"no_buffer_space\0"
+"value_too_large\0"
+"no_child_process\0"
+"invalid_argument\0"
+"connection_reset\0"
+"host_unreachable\0"
+"not_enough_memory\0"
+"permission_denied\0"
+"cross_device_link\0"
+"filename_too_long\0"
+"no_lock_available\0"
+"already_connected\0"
+"no_space_on_device\0"
+"operation_canceled\0"
+"connection_aborted\0"
+"connection_refused\0"
+"identifier_removed\0"
+"no_protocol_option\0"
+"bad_file_descriptor\0"
+"too_many_files_open\0"
+"result_out_of_range\0"
+"directory_not_empty\0"
+"network_unreachable\0"
+"no_stream_resources\0"
+"wrong_protocol_type\0"
+"no_message_available\0"
+"read_only_file_system\0"
+"illegal_byte_sequence\0"
+"address_not_available\0"
+"operation_in_progress\0"
+"state_not_recoverable\0"
+"operation_would_block\0"
+"argument_list_too_long\0"
+"argument_out_of_domain\0"
+"function_not_supported\0"
+"protocol_not_supported\0"
+"operation_not_permitted\0"
+"executable_format_error\0"
+"device_or_resource_busy\0"
+"operation_not_supported\0"
+"no_such_file_or_directory\0"
+"no_such_device_or_address\0"
+"address_family_not_supported\0"
+"destination_address_required\0"
+"too_many_files_open_in_system\0"
+"resource_deadlock_would_occur\0"
+"too_many_symbolic_link_levels\0"
+"resource_unavailable_try_again\0"
+"connection_already_in_progress\0"
+"inappropriate_io_control_operation\0"
+};
+inline constexpr ::enums::errc enum_string_values[78] = {
+::enums::errc::no_link,
+::enums::errc::io_error,
+::enums::errc::timed_out,
+::enums::errc::no_message,
+::enums::errc::owner_dead,
+::enums::errc::interrupted,
+::enums::errc::bad_address,
+::enums::errc::file_exists,
+::enums::errc::broken_pipe,
+::enums::errc::bad_message,
+::enums::errc::invalid_seek,
+::enums::errc::message_size,
+::enums::errc::network_down,
+::enums::errc::not_a_stream,
+::enums::errc::not_a_socket,
+::enums::errc::network_reset,
+::enums::errc::not_connected,
+::enums::errc::not_supported,
+::enums::errc::no_such_device,
+::enums::errc::is_a_directory,
+::enums::errc::file_too_large,
+::enums::errc::too_many_links,
+::enums::errc::address_in_use,
+::enums::errc::protocol_error,
+::enums::errc::stream_timeout,
+::enums::errc::text_file_busy,
+::enums::errc::no_such_process,
+::enums::errc::not_a_directory,
+::enums::errc::no_buffer_space,
+::enums::errc::value_too_large,
+::enums::errc::no_child_process,
+::enums::errc::invalid_argument,
+::enums::errc::connection_reset,
+::enums::errc::host_unreachable,
+::enums::errc::not_enough_memory,
+::enums::errc::permission_denied,
+::enums::errc::cross_device_link,
+::enums::errc::filename_too_long,
+::enums::errc::no_lock_available,
+::enums::errc::already_connected,
+::enums::errc::no_space_on_device,
+::enums::errc::operation_canceled,
+::enums::errc::connection_aborted,
+::enums::errc::connection_refused,
+::enums::errc::identifier_removed,
+::enums::errc::no_protocol_option,
+::enums::errc::bad_file_descriptor,
+::enums::errc::too_many_files_open,
+::enums::errc::result_out_of_range,
+::enums::errc::directory_not_empty,
+::enums::errc::network_unreachable,
+::enums::errc::no_stream_resources,
+::enums::errc::wrong_protocol_type,
+::enums::errc::no_message_available,
+::enums::errc::read_only_file_system,
+::enums::errc::illegal_byte_sequence,
+::enums::errc::address_not_available,
+::enums::errc::operation_in_progress,
+::enums::errc::state_not_recoverable,
+::enums::errc::operation_would_block,
+::enums::errc::argument_list_too_long,
+::enums::errc::argument_out_of_domain,
+::enums::errc::function_not_supported,
+::enums::errc::protocol_not_supported,
+::enums::errc::operation_not_permitted,
+::enums::errc::executable_format_error,
+::enums::errc::device_or_resource_busy,
+::enums::errc::operation_not_supported,
+::enums::errc::no_such_file_or_directory,
+::enums::errc::no_such_device_or_address,
+::enums::errc::address_family_not_supported,
+::enums::errc::destination_address_required,
+::enums::errc::too_many_files_open_in_system,
+::enums::errc::resource_deadlock_would_occur,
+::enums::errc::too_many_symbolic_link_levels,
+::enums::errc::resource_unavailable_try_again,
+::enums::errc::connection_already_in_progress,
+::enums::errc::inappropriate_io_control_operation,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::errc>() noexcept
+{
+return ::enums::detail::errc::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::errc> enumbra::from_integer<::enums::errc>(int32_t v) noexcept { 
+for(auto value : values<::enums::errc>()) {
+if(value == static_cast<::enums::errc>(v)) { return ::enumbra::optional_value<::enums::errc>(static_cast<::enums::errc>(v)); }
+}
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::errc>(::enums::errc e) noexcept { 
+for(auto value : values<::enums::errc>()) {
+if(value == e) { return true; }
+}
+return false;
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::errc>() noexcept { 
+return { "errc", 4 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::errc>() noexcept { 
+return { "enums::errc", 11 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::errc>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::errc v) noexcept {
+switch (v) {
+case ::enums::errc::no_link: return { &::enums::detail::errc::enum_strings[0], 7 };
+case ::enums::errc::io_error: return { &::enums::detail::errc::enum_strings[8], 8 };
+case ::enums::errc::timed_out: return { &::enums::detail::errc::enum_strings[17], 9 };
+case ::enums::errc::no_message: return { &::enums::detail::errc::enum_strings[27], 10 };
+case ::enums::errc::owner_dead: return { &::enums::detail::errc::enum_strings[38], 10 };
+case ::enums::errc::interrupted: return { &::enums::detail::errc::enum_strings[49], 11 };
+case ::enums::errc::bad_address: return { &::enums::detail::errc::enum_strings[61], 11 };
+case ::enums::errc::file_exists: return { &::enums::detail::errc::enum_strings[73], 11 };
+case ::enums::errc::broken_pipe: return { &::enums::detail::errc::enum_strings[85], 11 };
+case ::enums::errc::bad_message: return { &::enums::detail::errc::enum_strings[97], 11 };
+case ::enums::errc::invalid_seek: return { &::enums::detail::errc::enum_strings[109], 12 };
+case ::enums::errc::message_size: return { &::enums::detail::errc::enum_strings[122], 12 };
+case ::enums::errc::network_down: return { &::enums::detail::errc::enum_strings[135], 12 };
+case ::enums::errc::not_a_stream: return { &::enums::detail::errc::enum_strings[148], 12 };
+case ::enums::errc::not_a_socket: return { &::enums::detail::errc::enum_strings[161], 12 };
+case ::enums::errc::network_reset: return { &::enums::detail::errc::enum_strings[174], 13 };
+case ::enums::errc::not_connected: return { &::enums::detail::errc::enum_strings[188], 13 };
+case ::enums::errc::not_supported: return { &::enums::detail::errc::enum_strings[202], 13 };
+case ::enums::errc::no_such_device: return { &::enums::detail::errc::enum_strings[216], 14 };
+case ::enums::errc::is_a_directory: return { &::enums::detail::errc::enum_strings[231], 14 };
+case ::enums::errc::file_too_large: return { &::enums::detail::errc::enum_strings[246], 14 };
+case ::enums::errc::too_many_links: return { &::enums::detail::errc::enum_strings[261], 14 };
+case ::enums::errc::address_in_use: return { &::enums::detail::errc::enum_strings[276], 14 };
+case ::enums::errc::protocol_error: return { &::enums::detail::errc::enum_strings[291], 14 };
+case ::enums::errc::stream_timeout: return { &::enums::detail::errc::enum_strings[306], 14 };
+case ::enums::errc::text_file_busy: return { &::enums::detail::errc::enum_strings[321], 14 };
+case ::enums::errc::no_such_process: return { &::enums::detail::errc::enum_strings[336], 15 };
+case ::enums::errc::not_a_directory: return { &::enums::detail::errc::enum_strings[352], 15 };
+case ::enums::errc::no_buffer_space: return { &::enums::detail::errc::enum_strings[368], 15 };
+case ::enums::errc::value_too_large: return { &::enums::detail::errc::enum_strings[384], 15 };
+case ::enums::errc::no_child_process: return { &::enums::detail::errc::enum_strings[400], 16 };
+case ::enums::errc::invalid_argument: return { &::enums::detail::errc::enum_strings[417], 16 };
+case ::enums::errc::connection_reset: return { &::enums::detail::errc::enum_strings[434], 16 };
+case ::enums::errc::host_unreachable: return { &::enums::detail::errc::enum_strings[451], 16 };
+case ::enums::errc::not_enough_memory: return { &::enums::detail::errc::enum_strings[468], 17 };
+case ::enums::errc::permission_denied: return { &::enums::detail::errc::enum_strings[486], 17 };
+case ::enums::errc::cross_device_link: return { &::enums::detail::errc::enum_strings[504], 17 };
+case ::enums::errc::filename_too_long: return { &::enums::detail::errc::enum_strings[522], 17 };
+case ::enums::errc::no_lock_available: return { &::enums::detail::errc::enum_strings[540], 17 };
+case ::enums::errc::already_connected: return { &::enums::detail::errc::enum_strings[558], 17 };
+case ::enums::errc::no_space_on_device: return { &::enums::detail::errc::enum_strings[576], 18 };
+case ::enums::errc::operation_canceled: return { &::enums::detail::errc::enum_strings[595], 18 };
+case ::enums::errc::connection_aborted: return { &::enums::detail::errc::enum_strings[614], 18 };
+case ::enums::errc::connection_refused: return { &::enums::detail::errc::enum_strings[633], 18 };
+case ::enums::errc::identifier_removed: return { &::enums::detail::errc::enum_strings[652], 18 };
+case ::enums::errc::no_protocol_option: return { &::enums::detail::errc::enum_strings[671], 18 };
+case ::enums::errc::bad_file_descriptor: return { &::enums::detail::errc::enum_strings[690], 19 };
+case ::enums::errc::too_many_files_open: return { &::enums::detail::errc::enum_strings[710], 19 };
+case ::enums::errc::result_out_of_range: return { &::enums::detail::errc::enum_strings[730], 19 };
+case ::enums::errc::directory_not_empty: return { &::enums::detail::errc::enum_strings[750], 19 };
+case ::enums::errc::network_unreachable: return { &::enums::detail::errc::enum_strings[770], 19 };
+case ::enums::errc::no_stream_resources: return { &::enums::detail::errc::enum_strings[790], 19 };
+case ::enums::errc::wrong_protocol_type: return { &::enums::detail::errc::enum_strings[810], 19 };
+case ::enums::errc::no_message_available: return { &::enums::detail::errc::enum_strings[830], 20 };
+case ::enums::errc::read_only_file_system: return { &::enums::detail::errc::enum_strings[851], 21 };
+case ::enums::errc::illegal_byte_sequence: return { &::enums::detail::errc::enum_strings[873], 21 };
+case ::enums::errc::address_not_available: return { &::enums::detail::errc::enum_strings[895], 21 };
+case ::enums::errc::operation_in_progress: return { &::enums::detail::errc::enum_strings[917], 21 };
+case ::enums::errc::state_not_recoverable: return { &::enums::detail::errc::enum_strings[939], 21 };
+case ::enums::errc::operation_would_block: return { &::enums::detail::errc::enum_strings[961], 21 };
+case ::enums::errc::argument_list_too_long: return { &::enums::detail::errc::enum_strings[983], 22 };
+case ::enums::errc::argument_out_of_domain: return { &::enums::detail::errc::enum_strings[1006], 22 };
+case ::enums::errc::function_not_supported: return { &::enums::detail::errc::enum_strings[1029], 22 };
+case ::enums::errc::protocol_not_supported: return { &::enums::detail::errc::enum_strings[1052], 22 };
+case ::enums::errc::operation_not_permitted: return { &::enums::detail::errc::enum_strings[1075], 23 };
+case ::enums::errc::executable_format_error: return { &::enums::detail::errc::enum_strings[1099], 23 };
+case ::enums::errc::device_or_resource_busy: return { &::enums::detail::errc::enum_strings[1123], 23 };
+case ::enums::errc::operation_not_supported: return { &::enums::detail::errc::enum_strings[1147], 23 };
+case ::enums::errc::no_such_file_or_directory: return { &::enums::detail::errc::enum_strings[1171], 25 };
+case ::enums::errc::no_such_device_or_address: return { &::enums::detail::errc::enum_strings[1197], 25 };
+case ::enums::errc::address_family_not_supported: return { &::enums::detail::errc::enum_strings[1223], 28 };
+case ::enums::errc::destination_address_required: return { &::enums::detail::errc::enum_strings[1252], 28 };
+case ::enums::errc::too_many_files_open_in_system: return { &::enums::detail::errc::enum_strings[1281], 29 };
+case ::enums::errc::resource_deadlock_would_occur: return { &::enums::detail::errc::enum_strings[1311], 29 };
+case ::enums::errc::too_many_symbolic_link_levels: return { &::enums::detail::errc::enum_strings[1341], 29 };
+case ::enums::errc::resource_unavailable_try_again: return { &::enums::detail::errc::enum_strings[1371], 30 };
+case ::enums::errc::connection_already_in_progress: return { &::enums::detail::errc::enum_strings[1402], 30 };
+case ::enums::errc::inappropriate_io_control_operation: return { &::enums::detail::errc::enum_strings[1433], 34 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::errc> enumbra::from_string<::enums::errc>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 7: offset_str = 0; offset_enum = 0; count = 1; break;
+case 8: offset_str = 8; offset_enum = 1; count = 1; break;
+case 9: offset_str = 17; offset_enum = 2; count = 1; break;
+case 10: offset_str = 27; offset_enum = 3; count = 2; break;
+case 11: offset_str = 49; offset_enum = 5; count = 5; break;
+case 12: offset_str = 109; offset_enum = 10; count = 5; break;
+case 13: offset_str = 174; offset_enum = 15; count = 3; break;
+case 14: offset_str = 216; offset_enum = 18; count = 8; break;
+case 15: offset_str = 336; offset_enum = 26; count = 4; break;
+case 16: offset_str = 400; offset_enum = 30; count = 4; break;
+case 17: offset_str = 468; offset_enum = 34; count = 6; break;
+case 18: offset_str = 576; offset_enum = 40; count = 6; break;
+case 19: offset_str = 690; offset_enum = 46; count = 7; break;
+case 20: offset_str = 830; offset_enum = 53; count = 1; break;
+case 21: offset_str = 851; offset_enum = 54; count = 6; break;
+case 22: offset_str = 983; offset_enum = 60; count = 4; break;
+case 23: offset_str = 1075; offset_enum = 64; count = 4; break;
+case 25: offset_str = 1171; offset_enum = 68; count = 2; break;
+case 28: offset_str = 1223; offset_enum = 70; count = 2; break;
+case 29: offset_str = 1281; offset_enum = 72; count = 3; break;
+case 30: offset_str = 1371; offset_enum = 75; count = 2; break;
+case 34: offset_str = 1433; offset_enum = 77; count = 1; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::errc::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::errc>(::enums::detail::errc::enum_string_values[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::errc> enumbra::from_string<::enums::errc>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::errc>(str, len);
+}
+
+
+export namespace enums {
+enum class OutOfLineTest : int32_t {
+Sun = 0,
+Moon = 1,
+Earth = 2,
+Venus = 3,
+Saturn = 4,
+Mercury = 5,
+Jupiter = 6,
+Neptune = 7,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::OutOfLineTest> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::OutOfLineTest> : enumbra::detail::enum_info<int32_t, 0, 7, 0, 8, true, 4, 3, true, -1> { };
+
+namespace enums::detail::OutOfLineTest {
+inline constexpr ::enums::OutOfLineTest values_arr[8] =
+{
+::enums::OutOfLineTest::Sun,
+::enums::OutOfLineTest::Moon,
+::enums::OutOfLineTest::Earth,
+::enums::OutOfLineTest::Venus,
+::enums::OutOfLineTest::Saturn,
+::enums::OutOfLineTest::Mercury,
+::enums::OutOfLineTest::Jupiter,
+::enums::OutOfLineTest::Neptune,
+};
+inline constexpr const char enum_strings[53] = {
+"Sun\0"
+"Moon\0"
+"Earth\0"
+"Venus\0"
+"Saturn\0"
+"Mercury\0"
+"Jupiter\0"
+"Neptune\0"
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::OutOfLineTest>() noexcept
+{
+return ::enums::detail::OutOfLineTest::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_integer<::enums::OutOfLineTest>(int32_t v) noexcept { 
+if((0 <= v) && (v <= 7)) { return ::enumbra::optional_value<::enums::OutOfLineTest>(static_cast<::enums::OutOfLineTest>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::OutOfLineTest>(::enums::OutOfLineTest e) noexcept { 
+return (0 <= static_cast<int32_t>(e)) && (static_cast<int32_t>(e) <= 7);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::OutOfLineTest>() noexcept { 
+return { "OutOfLineTest", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::OutOfLineTest>() noexcept { 
+return { "enums::OutOfLineTest", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::OutOfLineTest>() noexcept { 
+return { "enums", 5 };
+}
+
+export namespace enumbra {
+constexpr ::enumbra::string_view to_string(const ::enums::OutOfLineTest v) noexcept {
+switch (v) {
+case ::enums::OutOfLineTest::Sun: return { &::enums::detail::OutOfLineTest::enum_strings[0], 3 };
+case ::enums::OutOfLineTest::Moon: return { &::enums::detail::OutOfLineTest::enum_strings[4], 4 };
+case ::enums::OutOfLineTest::Earth: return { &::enums::detail::OutOfLineTest::enum_strings[9], 5 };
+case ::enums::OutOfLineTest::Venus: return { &::enums::detail::OutOfLineTest::enum_strings[15], 5 };
+case ::enums::OutOfLineTest::Saturn: return { &::enums::detail::OutOfLineTest::enum_strings[21], 6 };
+case ::enums::OutOfLineTest::Mercury: return { &::enums::detail::OutOfLineTest::enum_strings[28], 7 };
+case ::enums::OutOfLineTest::Jupiter: return { &::enums::detail::OutOfLineTest::enum_strings[36], 7 };
+case ::enums::OutOfLineTest::Neptune: return { &::enums::detail::OutOfLineTest::enum_strings[44], 7 };
+}
+return { nullptr, 0 };
+}
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_string<::enums::OutOfLineTest>(const char* str, int len) noexcept {
+int offset_str = 0;
+int offset_enum = 0;
+int count = 0;
+switch(len) {
+case 3: offset_str = 0; offset_enum = 0; count = 1; break;
+case 4: offset_str = 4; offset_enum = 1; count = 1; break;
+case 5: offset_str = 9; offset_enum = 2; count = 2; break;
+case 6: offset_str = 21; offset_enum = 4; count = 1; break;
+case 7: offset_str = 28; offset_enum = 5; count = 3; break;
+default: return {};
+}
+for (int i = 0; i < count; i++) {
+if (::enumbra::detail::streq_known_size(::enums::detail::OutOfLineTest::enum_strings + offset_str + (i * (len + 1)), str, len)) {
+return ::enumbra::optional_value<::enums::OutOfLineTest>(::enums::detail::OutOfLineTest::values_arr[offset_enum + i]);
+}
+}
+return {};
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_string<::enums::OutOfLineTest>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::OutOfLineTest>(str, len);
+}
+
+
+export namespace enums {
+enum class test_flags : uint32_t {
+B = 1,
+C = 2,
+};
+
+namespace detail::test_flags {
+inline constexpr ::enums::test_flags flags_arr[2] =
+{
+::enums::test_flags::B,
+::enums::test_flags::C,
+};
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::test_flags>() noexcept
+{
+return ::enums::detail::test_flags::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::test_flags>(::enums::test_flags e) noexcept { 
+return (static_cast<uint32_t>(e) | static_cast<uint32_t>(0x3)) == static_cast<uint32_t>(0x3);
+}
+
+template<> constexpr void clear(::enums::test_flags& value) noexcept { value = static_cast<::enums::test_flags>(0); }
+template<> constexpr bool test(::enums::test_flags value, ::enums::test_flags flags) noexcept { return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(value)) == static_cast<uint32_t>(flags); }
+template<> constexpr void set(::enums::test_flags& value, ::enums::test_flags flags) noexcept { value = static_cast<::enums::test_flags>(static_cast<uint32_t>(value) | static_cast<uint32_t>(flags)); }
+template<> constexpr void unset(::enums::test_flags& value, ::enums::test_flags flags) noexcept { value = static_cast<::enums::test_flags>(static_cast<uint32_t>(value) & (~static_cast<uint32_t>(flags))); }
+template<> constexpr void toggle(::enums::test_flags& value, ::enums::test_flags flags) noexcept { value = static_cast<::enums::test_flags>(static_cast<uint32_t>(value) ^ static_cast<uint32_t>(flags)); }
+template<> constexpr bool has_all(::enums::test_flags value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x3)) == static_cast<uint32_t>(0x3); }
+template<> constexpr bool has_any(::enums::test_flags value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x3)) > 0; }
+template<> constexpr bool has_none(::enums::test_flags value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x3)) == 0; }
+template<> constexpr bool has_single(::enums::test_flags value) noexcept { uint32_t n = static_cast<uint32_t>(static_cast<uint32_t>(value) & 0x3); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::test_flags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x3) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::test_flags flag_from_index<::enums::test_flags>(int index) noexcept { return (index >= 0 && index < 2) ? static_cast<::enums::test_flags>(1ULL << (index + 0)) : ::enums::test_flags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::test_flags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x3) == 0x3)
+;
+}
+
+template<>
+constexpr ::enums::test_flags closure(::enums::test_flags value) noexcept {
+return value;
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::test_flags> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::test_flags> : enumbra::detail::enum_info<uint32_t, 0, 3, 0, 2, true, 2, 2, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::test_flags operator~(const ::enums::test_flags a) noexcept { return static_cast<::enums::test_flags>(~static_cast<uint32_t>(a)); }
+constexpr ::enums::test_flags operator|(const ::enums::test_flags a, const ::enums::test_flags b) noexcept { return static_cast<::enums::test_flags>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b)); }
+constexpr ::enums::test_flags operator&(const ::enums::test_flags a, const ::enums::test_flags b) noexcept { return static_cast<::enums::test_flags>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b)); }
+constexpr ::enums::test_flags operator^(const ::enums::test_flags a, const ::enums::test_flags b) noexcept { return static_cast<::enums::test_flags>(static_cast<uint32_t>(a) ^ static_cast<uint32_t>(b)); }
+constexpr ::enums::test_flags& operator|=(::enums::test_flags& a, const ::enums::test_flags b) noexcept { return a = a | b; }
+constexpr ::enums::test_flags& operator&=(::enums::test_flags& a, const ::enums::test_flags b) noexcept { return a = a & b; }
+constexpr ::enums::test_flags& operator^=(::enums::test_flags& a, const ::enums::test_flags b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<12> to_string(const ::enums::test_flags v) noexcept {
+::enumbra::stack_string<12> output;
+if (static_cast<uint32_t>(v & ::enums::test_flags::B) > 0) {
+output.append<1>("B");
+}
+if (static_cast<uint32_t>(v & ::enums::test_flags::C) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<1>("C");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_flags> from_string<::enums::test_flags>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::test_flags output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 1) {
+if (::enumbra::detail::streq_fixed_size<1>(start, "B")) { output |= ::enums::test_flags::B; }
+else if (::enumbra::detail::streq_fixed_size<1>(start, "C")) { output |= ::enums::test_flags::C; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::test_flags>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_flags> from_string<::enums::test_flags>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::test_flags>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags all_of, ::enums::test_flags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::test_flags>(::enums::test_flags* values, int count, ::enums::test_flags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::test_flags>(::enums::test_flags* values, int count, ::enums::test_flags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+export namespace enums {
+enum class test_nodefault : uint16_t {
+B = 1,
+C = 2,
+};
+
+namespace detail::test_nodefault {
+inline constexpr ::enums::test_nodefault flags_arr[2] =
+{
+::enums::test_nodefault::B,
+::enums::test_nodefault::C,
+};
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::test_nodefault>() noexcept
+{
+return ::enums::detail::test_nodefault::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::test_nodefault>(::enums::test_nodefault e) noexcept { 
+return (static_cast<uint16_t>(e) | static_cast<uint16_t>(0x3)) == static_cast<uint16_t>(0x3);
+}
+
+template<> constexpr void clear(::enums::test_nodefault& value) noexcept { value = static_cast<::enums::test_nodefault>(0); }
+template<> constexpr bool test(::enums::test_nodefault value, ::enums::test_nodefault flags) noexcept { return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(value)) == static_cast<uint16_t>(flags); }
+template<> constexpr void set(::enums::test_nodefault& value, ::enums::test_nodefault flags) noexcept { value = static_cast<::enums::test_nodefault>(static_cast<uint16_t>(value) | static_cast<uint16_t>(flags)); }
+template<> constexpr void unset(::enums::test_nodefault& value, ::enums::test_nodefault flags) noexcept { value = static_cast<::enums::test_nodefault>(static_cast<uint16_t>(value) & (~static_cast<uint16_t>(flags))); }
+template<> constexpr void toggle(::enums::test_nodefault& value, ::enums::test_nodefault flags) noexcept { value = static_cast<::enums::test_nodefault>(static_cast<uint16_t>(value) ^ static_cast<uint16_t>(flags)); }
+template<> constexpr bool has_all(::enums::test_nodefault value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x3)) == static_cast<uint16_t>(0x3); }
+template<> constexpr bool has_any(::enums::test_nodefault value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x3)) > 0; }
+template<> constexpr bool has_none(::enums::test_nodefault value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x3)) == 0; }
+template<> constexpr bool has_single(::enums::test_nodefault value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x3); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::test_nodefault flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x3) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::test_nodefault flag_from_index<::enums::test_nodefault>(int index) noexcept { return (index >= 0 && index < 2) ? static_cast<::enums::test_nodefault>(1ULL << (index + 0)) : ::enums::test_nodefault(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::test_nodefault value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x3) == 0x3)
+;
+}
+
+template<>
+constexpr ::enums::test_nodefault closure(::enums::test_nodefault value) noexcept {
+return value;
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::test_nodefault> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::test_nodefault> : enumbra::detail::enum_info<uint16_t, 0, 3, 0, 2, true, 2, 2, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::test_nodefault operator~(const ::enums::test_nodefault a) noexcept { return static_cast<::enums::test_nodefault>(~static_cast<uint16_t>(a)); }
+constexpr ::enums::test_nodefault operator|(const ::enums::test_nodefault a, const ::enums::test_nodefault b) noexcept { return static_cast<::enums::test_nodefault>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b)); }
+constexpr ::enums::test_nodefault operator&(const ::enums::test_nodefault a, const ::enums::test_nodefault b) noexcept { return static_cast<::enums::test_nodefault>(static_cast<uint16_t>(a) & static_cast<uint16_t>(b)); }
+constexpr ::enums::test_nodefault operator^(const ::enums::test_nodefault a, const ::enums::test_nodefault b) noexcept { return static_cast<::enums::test_nodefault>(static_cast<uint16_t>(a) ^ static_cast<uint16_t>(b)); }
+constexpr ::enums::test_nodefault& operator|=(::enums::test_nodefault& a, const ::enums::test_nodefault b) noexcept { return a = a | b; }
+constexpr ::enums::test_nodefault& operator&=(::enums::test_nodefault& a, const ::enums::test_nodefault b) noexcept { return a = a & b; }
+constexpr ::enums::test_nodefault& operator^=(::enums::test_nodefault& a, const ::enums::test_nodefault b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<12> to_string(const ::enums::test_nodefault v) noexcept {
+::enumbra::stack_string<12> output;
+if (static_cast<uint16_t>(v & ::enums::test_nodefault::B) > 0) {
+output.append<1>("B");
+}
+if (static_cast<uint16_t>(v & ::enums::test_nodefault::C) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<1>("C");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_nodefault> from_string<::enums::test_nodefault>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::test_nodefault output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 1) {
+if (::enumbra::detail::streq_fixed_size<1>(start, "B")) { output |= ::enums::test_nodefault::B; }
+else if (::enumbra::detail::streq_fixed_size<1>(start, "C")) { output |= ::enums::test_nodefault::C; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::test_nodefault>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::test_nodefault> from_string<::enums::test_nodefault>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::test_nodefault>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault all_of, ::enums::test_nodefault none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::test_nodefault>(::enums::test_nodefault* values, int count, ::enums::test_nodefault flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::test_nodefault>(::enums::test_nodefault* values, int count, ::enums::test_nodefault flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+export namespace enums {
+enum class TestSparseFlags : uint16_t {
+B = 1,
+C = 4,
+D = 16,
+};
+
+namespace detail::TestSparseFlags {
+inline constexpr ::enums::TestSparseFlags flags_arr[3] =
+{
+::enums::TestSparseFlags::B,
+::enums::TestSparseFlags::C,
+::enums::TestSparseFlags::D,
+};
+inline constexpr signed char flag_bit_index[5] = { 0, -1, 1, -1, 2 };
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::TestSparseFlags>() noexcept
+{
+return ::enums::detail::TestSparseFlags::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::TestSparseFlags>(::enums::TestSparseFlags e) noexcept { 
+return (static_cast<uint16_t>(e) | static_cast<uint16_t>(0x15)) == static_cast<uint16_t>(0x15);
+}
+
+template<> constexpr void clear(::enums::TestSparseFlags& value) noexcept { value = static_cast<::enums::TestSparseFlags>(0); }
+template<> constexpr bool test(::enums::TestSparseFlags value, ::enums::TestSparseFlags flags) noexcept { return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(value)) == static_cast<uint16_t>(flags); }
+template<> constexpr void set(::enums::TestSparseFlags& value, ::enums::TestSparseFlags flags) noexcept { value = static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(value) | static_cast<uint16_t>(flags)); }
+template<> constexpr void unset(::enums::TestSparseFlags& value, ::enums::TestSparseFlags flags) noexcept { value = static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(value) & (~static_cast<uint16_t>(flags))); }
+template<> constexpr void toggle(::enums::TestSparseFlags& value, ::enums::TestSparseFlags flags) noexcept { value = static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(value) ^ static_cast<uint16_t>(flags)); }
+template<> constexpr bool has_all(::enums::TestSparseFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x15)) == static_cast<uint16_t>(0x15); }
+template<> constexpr bool has_any(::enums::TestSparseFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x15)) > 0; }
+template<> constexpr bool has_none(::enums::TestSparseFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x15)) == 0; }
+template<> constexpr bool has_single(::enums::TestSparseFlags value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x15); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::TestSparseFlags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return (n != 0 && (n & (n - 1)) == 0 && n <= 0x15) ? ::enums::detail::TestSparseFlags::flag_bit_index[::enumbra::detail::countr_zero(n)] : -1; }
+template<> constexpr ::enums::TestSparseFlags flag_from_index<::enums::TestSparseFlags>(int index) noexcept { return (index >= 0 && index < 3) ? ::enums::detail::TestSparseFlags::flags_arr[index] : ::enums::TestSparseFlags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestSparseFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x15) == 0x15)
+;
+}
+
+template<>
+constexpr ::enums::TestSparseFlags closure(::enums::TestSparseFlags value) noexcept {
+return value;
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::TestSparseFlags> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::TestSparseFlags> : enumbra::detail::enum_info<uint16_t, 0, 21, 0, 3, false, 5, 5, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::TestSparseFlags operator~(const ::enums::TestSparseFlags a) noexcept { return static_cast<::enums::TestSparseFlags>(~static_cast<uint16_t>(a)); }
+constexpr ::enums::TestSparseFlags operator|(const ::enums::TestSparseFlags a, const ::enums::TestSparseFlags b) noexcept { return static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSparseFlags operator&(const ::enums::TestSparseFlags a, const ::enums::TestSparseFlags b) noexcept { return static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(a) & static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSparseFlags operator^(const ::enums::TestSparseFlags a, const ::enums::TestSparseFlags b) noexcept { return static_cast<::enums::TestSparseFlags>(static_cast<uint16_t>(a) ^ static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSparseFlags& operator|=(::enums::TestSparseFlags& a, const ::enums::TestSparseFlags b) noexcept { return a = a | b; }
+constexpr ::enums::TestSparseFlags& operator&=(::enums::TestSparseFlags& a, const ::enums::TestSparseFlags b) noexcept { return a = a & b; }
+constexpr ::enums::TestSparseFlags& operator^=(::enums::TestSparseFlags& a, const ::enums::TestSparseFlags b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<12> to_string(const ::enums::TestSparseFlags v) noexcept {
+::enumbra::stack_string<12> output;
+if (static_cast<uint16_t>(v & ::enums::TestSparseFlags::B) > 0) {
+output.append<1>("B");
+}
+if (static_cast<uint16_t>(v & ::enums::TestSparseFlags::C) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<1>("C");
+}
+if (static_cast<uint16_t>(v & ::enums::TestSparseFlags::D) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<1>("D");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestSparseFlags> from_string<::enums::TestSparseFlags>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::TestSparseFlags output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 1) {
+if (::enumbra::detail::streq_fixed_size<1>(start, "B")) { output |= ::enums::TestSparseFlags::B; }
+else if (::enumbra::detail::streq_fixed_size<1>(start, "C")) { output |= ::enums::TestSparseFlags::C; }
+else if (::enumbra::detail::streq_fixed_size<1>(start, "D")) { output |= ::enums::TestSparseFlags::D; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::TestSparseFlags>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestSparseFlags> from_string<::enums::TestSparseFlags>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::TestSparseFlags>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags all_of, ::enums::TestSparseFlags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestSparseFlags>(::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestSparseFlags>(::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+export namespace enums {
+enum class TestSingleFlag : uint16_t {
+C = 4,
+};
+
+namespace detail::TestSingleFlag {
+inline constexpr ::enums::TestSingleFlag flags_arr[1] =
+{
+::enums::TestSingleFlag::C,
+};
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::TestSingleFlag>() noexcept
+{
+return ::enums::detail::TestSingleFlag::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::TestSingleFlag>(::enums::TestSingleFlag e) noexcept { 
+return (static_cast<uint16_t>(e) | static_cast<uint16_t>(0x4)) == static_cast<uint16_t>(0x4);
+}
+
+template<> constexpr void clear(::enums::TestSingleFlag& value) noexcept { value = static_cast<::enums::TestSingleFlag>(0); }
+template<> constexpr bool test(::enums::TestSingleFlag value, ::enums::TestSingleFlag flags) noexcept { return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(value)) == static_cast<uint16_t>(flags); }
+template<> constexpr void set(::enums::TestSingleFlag& value, ::enums::TestSingleFlag flags) noexcept { value = static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(value) | static_cast<uint16_t>(flags)); }
+template<> constexpr void unset(::enums::TestSingleFlag& value, ::enums::TestSingleFlag flags) noexcept { value = static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(value) & (~static_cast<uint16_t>(flags))); }
+template<> constexpr void toggle(::enums::TestSingleFlag& value, ::enums::TestSingleFlag flags) noexcept { value = static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(value) ^ static_cast<uint16_t>(flags)); }
+template<> constexpr bool has_all(::enums::TestSingleFlag value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x4)) == static_cast<uint16_t>(0x4); }
+template<> constexpr bool has_any(::enums::TestSingleFlag value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x4)) > 0; }
+template<> constexpr bool has_none(::enums::TestSingleFlag value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x4)) == 0; }
+template<> constexpr bool has_single(::enums::TestSingleFlag value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x4); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::TestSingleFlag flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x4 && n <= 0x4) ? (::enumbra::detail::countr_zero(n) - 2) : -1; }
+template<> constexpr ::enums::TestSingleFlag flag_from_index<::enums::TestSingleFlag>(int index) noexcept { return (index >= 0 && index < 1) ? static_cast<::enums::TestSingleFlag>(1ULL << (index + 2)) : ::enums::TestSingleFlag(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestSingleFlag value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x4) == 0x4)
+;
+}
+
+template<>
+constexpr ::enums::TestSingleFlag closure(::enums::TestSingleFlag value) noexcept {
+return value;
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::TestSingleFlag> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::TestSingleFlag> : enumbra::detail::enum_info<uint16_t, 0, 4, 0, 1, true, 3, 3, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::TestSingleFlag operator~(const ::enums::TestSingleFlag a) noexcept { return static_cast<::enums::TestSingleFlag>(~static_cast<uint16_t>(a)); }
+constexpr ::enums::TestSingleFlag operator|(const ::enums::TestSingleFlag a, const ::enums::TestSingleFlag b) noexcept { return static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSingleFlag operator&(const ::enums::TestSingleFlag a, const ::enums::TestSingleFlag b) noexcept { return static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(a) & static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSingleFlag operator^(const ::enums::TestSingleFlag a, const ::enums::TestSingleFlag b) noexcept { return static_cast<::enums::TestSingleFlag>(static_cast<uint16_t>(a) ^ static_cast<uint16_t>(b)); }
+constexpr ::enums::TestSingleFlag& operator|=(::enums::TestSingleFlag& a, const ::enums::TestSingleFlag b) noexcept { return a = a | b; }
+constexpr ::enums::TestSingleFlag& operator&=(::enums::TestSingleFlag& a, const ::enums::TestSingleFlag b) noexcept { return a = a & b; }
+constexpr ::enums::TestSingleFlag& operator^=(::enums::TestSingleFlag& a, const ::enums::TestSingleFlag b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<12> to_string(const ::enums::TestSingleFlag v) noexcept {
+::enumbra::stack_string<12> output;
+if (static_cast<uint16_t>(v & ::enums::TestSingleFlag::C) > 0) {
+output.append<1>("C");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestSingleFlag> from_string<::enums::TestSingleFlag>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::TestSingleFlag output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 1) {
+if (::enumbra::detail::streq_fixed_size<1>(start, "C")) { output |= ::enums::TestSingleFlag::C; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::TestSingleFlag>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestSingleFlag> from_string<::enums::TestSingleFlag>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::TestSingleFlag>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag all_of, ::enums::TestSingleFlag none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestSingleFlag>(::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestSingleFlag>(::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+export namespace enums {
+enum class Blorp : uint32_t {
+big = 1,
+bigger = 2,
+biggest = 4,
+};
+
+namespace detail::Blorp {
+inline constexpr ::enums::Blorp flags_arr[3] =
+{
+::enums::Blorp::big,
+::enums::Blorp::bigger,
+::enums::Blorp::biggest,
+};
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::Blorp>() noexcept
+{
+return ::enums::detail::Blorp::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::Blorp>(::enums::Blorp e) noexcept { 
+return (static_cast<uint32_t>(e) | static_cast<uint32_t>(0x7)) == static_cast<uint32_t>(0x7);
+}
+
+template<> constexpr void clear(::enums::Blorp& value) noexcept { value = static_cast<::enums::Blorp>(0); }
+template<> constexpr bool test(::enums::Blorp value, ::enums::Blorp flags) noexcept { return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(value)) == static_cast<uint32_t>(flags); }
+template<> constexpr void set(::enums::Blorp& value, ::enums::Blorp flags) noexcept { value = static_cast<::enums::Blorp>(static_cast<uint32_t>(value) | static_cast<uint32_t>(flags)); }
+template<> constexpr void unset(::enums::Blorp& value, ::enums::Blorp flags) noexcept { value = static_cast<::enums::Blorp>(static_cast<uint32_t>(value) & (~static_cast<uint32_t>(flags))); }
+template<> constexpr void toggle(::enums::Blorp& value, ::enums::Blorp flags) noexcept { value = static_cast<::enums::Blorp>(static_cast<uint32_t>(value) ^ static_cast<uint32_t>(flags)); }
+template<> constexpr bool has_all(::enums::Blorp value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x7)) == static_cast<uint32_t>(0x7); }
+template<> constexpr bool has_any(::enums::Blorp value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x7)) > 0; }
+template<> constexpr bool has_none(::enums::Blorp value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x7)) == 0; }
+template<> constexpr bool has_single(::enums::Blorp value) noexcept { uint32_t n = static_cast<uint32_t>(static_cast<uint32_t>(value) & 0x7); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::Blorp flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x7) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::Blorp flag_from_index<::enums::Blorp>(int index) noexcept { return (index >= 0 && index < 3) ? static_cast<::enums::Blorp>(1ULL << (index + 0)) : ::enums::Blorp(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::Blorp value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x7) == 0x7)
+;
+}
+
+template<>
+constexpr ::enums::Blorp closure(::enums::Blorp value) noexcept {
+return value;
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::Blorp> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::Blorp> : enumbra::detail::enum_info<uint32_t, 0, 7, 0, 3, true, 3, 3, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::Blorp operator~(const ::enums::Blorp a) noexcept { return static_cast<::enums::Blorp>(~static_cast<uint32_t>(a)); }
+constexpr ::enums::Blorp operator|(const ::enums::Blorp a, const ::enums::Blorp b) noexcept { return static_cast<::enums::Blorp>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b)); }
+constexpr ::enums::Blorp operator&(const ::enums::Blorp a, const ::enums::Blorp b) noexcept { return static_cast<::enums::Blorp>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b)); }
+constexpr ::enums::Blorp operator^(const ::enums::Blorp a, const ::enums::Blorp b) noexcept { return static_cast<::enums::Blorp>(static_cast<uint32_t>(a) ^ static_cast<uint32_t>(b)); }
+constexpr ::enums::Blorp& operator|=(::enums::Blorp& a, const ::enums::Blorp b) noexcept { return a = a | b; }
+constexpr ::enums::Blorp& operator&=(::enums::Blorp& a, const ::enums::Blorp b) noexcept { return a = a & b; }
+constexpr ::enums::Blorp& operator^=(::enums::Blorp& a, const ::enums::Blorp b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<28> to_string(const ::enums::Blorp v) noexcept {
+::enumbra::stack_string<28> output;
+if (static_cast<uint32_t>(v & ::enums::Blorp::big) > 0) {
+output.append<3>("big");
+}
+if (static_cast<uint32_t>(v & ::enums::Blorp::bigger) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<6>("bigger");
+}
+if (static_cast<uint32_t>(v & ::enums::Blorp::biggest) > 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<7>("biggest");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Blorp> from_string<::enums::Blorp>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::Blorp output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 3) {
+if (::enumbra::detail::streq_fixed_size<3>(start, "big")) { output |= ::enums::Blorp::big; }
+else { return {}; }
+}
+else if (check_len == 6) {
+if (::enumbra::detail::streq_fixed_size<6>(start, "bigger")) { output |= ::enums::Blorp::bigger; }
+else { return {}; }
+}
+else if (check_len == 7) {
+if (::enumbra::detail::streq_fixed_size<7>(start, "biggest")) { output |= ::enums::Blorp::biggest; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::Blorp>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::Blorp> from_string<::enums::Blorp>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::Blorp>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp all_of, ::enums::Blorp none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::Blorp>(::enums::Blorp* values, int count, ::enums::Blorp flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::Blorp>(::enums::Blorp* values, int count, ::enums::Blorp flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+export namespace enums {
+enum class TestConstrainedFlags : uint16_t {
+COMPRESS_NONE = 1,
+COMPRESS_LZ4 = 2,
+COMPRESS_ZSTD = 4,
+ENCRYPTED = 8,
+SIGNED = 16,
+CHECKSUMMED = 32,
+STREAMING = 64,
+BUFFERED = 0x200,
+};
+
+namespace detail::TestConstrainedFlags {
+inline constexpr ::enums::TestConstrainedFlags flags_arr[8] =
+{
+::enums::TestConstrainedFlags::COMPRESS_NONE,
+::enums::TestConstrainedFlags::COMPRESS_LZ4,
+::enums::TestConstrainedFlags::COMPRESS_ZSTD,
+::enums::TestConstrainedFlags::ENCRYPTED,
+::enums::TestConstrainedFlags::SIGNED,
+::enums::TestConstrainedFlags::CHECKSUMMED,
+::enums::TestConstrainedFlags::STREAMING,
+::enums::TestConstrainedFlags::BUFFERED,
+};
+inline constexpr signed char flag_bit_index[10] = { 0, 1, 2, 3, 4, 5, 6, -1, -1, 7 };
+inline constexpr uint16_t closure_table_0[256] = { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 };
+inline constexpr uint16_t closure_table_1[256] = { 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30 };
+}
+
+namespace presets::TestConstrainedFlags {
+inline constexpr ::enums::TestConstrainedFlags VERIFIED = static_cast<::enums::TestConstrainedFlags>(0x30);
+inline constexpr ::enums::TestConstrainedFlags SECURE = static_cast<::enums::TestConstrainedFlags>(0x38);
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::TestConstrainedFlags>() noexcept
+{
+return ::enums::detail::TestConstrainedFlags::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags e) noexcept { 
+return (static_cast<uint16_t>(e) | static_cast<uint16_t>(0x27f)) == static_cast<uint16_t>(0x27f);
+}
+
+template<> constexpr void clear(::enums::TestConstrainedFlags& value) noexcept { value = static_cast<::enums::TestConstrainedFlags>(0); }
+template<> constexpr bool test(::enums::TestConstrainedFlags value, ::enums::TestConstrainedFlags flags) noexcept { return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(value)) == static_cast<uint16_t>(flags); }
+template<> constexpr void set(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) | static_cast<uint16_t>(flags)); }
+template<> constexpr void unset(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) & (~static_cast<uint16_t>(flags))); }
+template<> constexpr void toggle(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) ^ static_cast<uint16_t>(flags)); }
+template<> constexpr bool has_all(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) == static_cast<uint16_t>(0x27f); }
+template<> constexpr bool has_any(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) > 0; }
+template<> constexpr bool has_none(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) == 0; }
+template<> constexpr bool has_single(::enums::TestConstrainedFlags value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x27f); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::TestConstrainedFlags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return (n != 0 && (n & (n - 1)) == 0 && n <= 0x27f) ? ::enums::detail::TestConstrainedFlags::flag_bit_index[::enumbra::detail::countr_zero(n)] : -1; }
+template<> constexpr ::enums::TestConstrainedFlags flag_from_index<::enums::TestConstrainedFlags>(int index) noexcept { return (index >= 0 && index < 8) ? ::enums::detail::TestConstrainedFlags::flags_arr[index] : ::enums::TestConstrainedFlags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestConstrainedFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x27f) == 0x27f)
+&& (::enumbra::detail::popcount(n & 0x7) == 1)
+&& (::enumbra::detail::popcount(n & 0x240) <= 1)
+&& (((n & 0x8) == 0) || ((n & 0x10) == 0x10))
+&& (((n & 0x200) == 0) || ((n & 0x10) == 0x10))
+&& (((n & 0x10) == 0) || ((n & 0x20) == 0x20))
+;
+}
+
+template<>
+constexpr ::enums::TestConstrainedFlags closure(::enums::TestConstrainedFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return static_cast<::enums::TestConstrainedFlags>(n | ::enums::detail::TestConstrainedFlags::closure_table_0[(n >> 0) & 0xFF] | ::enums::detail::TestConstrainedFlags::closure_table_1[(n >> 8) & 0xFF]);
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::TestConstrainedFlags> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::TestConstrainedFlags> : enumbra::detail::enum_info<uint16_t, 0, 0x27F, 0, 8, false, 10, 10, false, 0> { };
+
+export namespace enums {
+constexpr ::enums::TestConstrainedFlags operator~(const ::enums::TestConstrainedFlags a) noexcept { return static_cast<::enums::TestConstrainedFlags>(~static_cast<uint16_t>(a)); }
+constexpr ::enums::TestConstrainedFlags operator|(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags operator&(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) & static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags operator^(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) ^ static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags& operator|=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a | b; }
+constexpr ::enums::TestConstrainedFlags& operator&=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a & b; }
+constexpr ::enums::TestConstrainedFlags& operator^=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+export namespace enumbra {
+
+constexpr ::enumbra::stack_string<108> to_string(const ::enums::TestConstrainedFlags v) noexcept {
+::enumbra::stack_string<108> output;
+const unsigned long long value = static_cast<unsigned long long>(v);
+unsigned long long remaining = value;
+if (((value & 0x38) == 0x38) && ((remaining & 0x38) != 0)) {
+if (!output.empty()) { output.append('|'); }
+output.append<6>("SECURE");
+remaining &= ~0x38ULL;
+}
+if (((value & 0x30) == 0x30) && ((remaining & 0x30) != 0)) {
+if (!output.empty()) { output.append('|'); }
+output.append<8>("VERIFIED");
+remaining &= ~0x30ULL;
+}
+if ((remaining & 0x1) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<13>("COMPRESS_NONE");
+}
+if ((remaining & 0x2) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<12>("COMPRESS_LZ4");
+}
+if ((remaining & 0x4) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<13>("COMPRESS_ZSTD");
+}
+if ((remaining & 0x8) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<9>("ENCRYPTED");
+}
+if ((remaining & 0x10) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<6>("SIGNED");
+}
+if ((remaining & 0x20) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<11>("CHECKSUMMED");
+}
+if ((remaining & 0x40) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<9>("STREAMING");
+}
+if ((remaining & 0x200) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<8>("BUFFERED");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestConstrainedFlags> from_string<::enums::TestConstrainedFlags>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::TestConstrainedFlags output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 6) {
+if (::enumbra::detail::streq_fixed_size<6>(start, "SECURE")) { output |= ::enums::presets::TestConstrainedFlags::SECURE; }
+else if (::enumbra::detail::streq_fixed_size<6>(start, "SIGNED")) { output |= ::enums::TestConstrainedFlags::SIGNED; }
+else { return {}; }
+}
+else if (check_len == 8) {
+if (::enumbra::detail::streq_fixed_size<8>(start, "BUFFERED")) { output |= ::enums::TestConstrainedFlags::BUFFERED; }
+else if (::enumbra::detail::streq_fixed_size<8>(start, "VERIFIED")) { output |= ::enums::presets::TestConstrainedFlags::VERIFIED; }
+else { return {}; }
+}
+else if (check_len == 9) {
+if (::enumbra::detail::streq_fixed_size<9>(start, "ENCRYPTED")) { output |= ::enums::TestConstrainedFlags::ENCRYPTED; }
+else if (::enumbra::detail::streq_fixed_size<9>(start, "STREAMING")) { output |= ::enums::TestConstrainedFlags::STREAMING; }
+else { return {}; }
+}
+else if (check_len == 11) {
+if (::enumbra::detail::streq_fixed_size<11>(start, "CHECKSUMMED")) { output |= ::enums::TestConstrainedFlags::CHECKSUMMED; }
+else { return {}; }
+}
+else if (check_len == 12) {
+if (::enumbra::detail::streq_fixed_size<12>(start, "COMPRESS_LZ4")) { output |= ::enums::TestConstrainedFlags::COMPRESS_LZ4; }
+else { return {}; }
+}
+else if (check_len == 13) {
+if (::enumbra::detail::streq_fixed_size<13>(start, "COMPRESS_NONE")) { output |= ::enums::TestConstrainedFlags::COMPRESS_NONE; }
+else if (::enumbra::detail::streq_fixed_size<13>(start, "COMPRESS_ZSTD")) { output |= ::enums::TestConstrainedFlags::COMPRESS_ZSTD; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::TestConstrainedFlags>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestConstrainedFlags> from_string<::enums::TestConstrainedFlags>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::TestConstrainedFlags>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags all_of, ::enums::TestConstrainedFlags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
@@ -5,8 +5,8 @@
 
 // This is where you would put your code license!
 
-#ifndef ENUMBRA_330E78AF79EDD327_H
-#define ENUMBRA_330E78AF79EDD327_H
+#ifndef ENUMBRA_5792ACFBE51CAA08_H
+#define ENUMBRA_5792ACFBE51CAA08_H
 
 #include <cstdint>
 
@@ -83,7 +83,7 @@
 #endif
 
 #if !defined(ENUMBRA_BASE_TEMPLATES_VERSION)
-#define ENUMBRA_BASE_TEMPLATES_VERSION 31
+#define ENUMBRA_BASE_TEMPLATES_VERSION 35
 namespace enumbra {
     namespace detail {
         // Re-Implementation of std:: features to avoid including std headers
@@ -160,6 +160,40 @@ namespace enumbra {
             while (a[count] != 0) { count++; }
             return count;
         }
+        // Number of set bits
+        constexpr int popcount(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(v);
+#else
+            v = v - ((v >> 1) & 0x5555555555555555ULL);
+            v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+        // Position of the lowest set bit, v must not be 0
+        constexpr int countr_zero(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(v);
+#else
+            return popcount((v & (~v + 1)) - 1);
+#endif
+        }
+        // Position of the highest set bit, v must not be 0
+        constexpr int highest_bit(unsigned long long v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(v);
+#else
+            int bit = 0;
+            if (v >> 32) { v >>= 32; bit += 32; }
+            if (v >> 16) { v >>= 16; bit += 16; }
+            if (v >> 8) { v >>= 8; bit += 8; }
+            if (v >> 4) { v >>= 4; bit += 4; }
+            if (v >> 2) { v >>= 2; bit += 2; }
+            if (v >> 1) { bit += 1; }
+            return bit;
+#endif
+        }
     } // end namespace enumbra::detail
 
     template<class T>
@@ -263,9 +297,9 @@ namespace enumbra {
             }
         }
 
-        constexpr bool has_value() const { return operator bool(); }
+        constexpr bool has_value() const { return static_cast<bool>(*this); }
         constexpr T value() const { return v; }
-        constexpr T value_or(T default_value) const { return operator bool() ? v : default_value; }
+        constexpr T value_or(T default_value) const { return static_cast<bool>(*this) ? v : default_value; }
     };
 
     struct string_view {
@@ -358,6 +392,44 @@ namespace enumbra {
     template<class T>
     constexpr bool has_single(T value) noexcept = delete;
 
+    // True if value only contains defined flags and meets every constraint declared in the schema
+    template<class T>
+    constexpr bool satisfies_constraints(T value) noexcept = delete;
+
+    // Sets every flag implied by the flags in value
+    template<class T>
+    constexpr T closure(T value) noexcept = delete;
+
+    // Ordinal of a single flag within flags<T>(), or -1 if flag is not exactly one defined flag
+    template<class T>
+    constexpr int flag_index(T flag) noexcept = delete;
+
+    // Inverse of flag_index, returns T() if index is out of range
+    template<class T>
+    constexpr T flag_from_index(int index) noexcept = delete;
+
+    template<class T>
+    constexpr int count_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        return detail::popcount(static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max));
+    }
+
+    // Returns the lowest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T lowest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>(n & (~n + 1));
+    }
+
+    // Returns the highest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T highest_set(T value) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>((n != 0) ? (1ULL << detail::highest_bit(n)) : 0ULL);
+    }
+
     template<typename Value, typename Func>
     constexpr void flags_switch(Value v, Func&& func) {
         static_assert(::enumbra::is_enumbra_flags_enum<Value>, "Value is not an enumbra flags enum");
@@ -368,18 +440,275 @@ namespace enumbra {
         }
     }
 
+    // Batch operations over contiguous arrays of flags values.
+    // selection receives one bit per value and must hold at least (count + 63) / 64 words.
+    // indices receives the index of each matching value and must hold at least count entries.
+    // Each returns the number of matching values. Generated headers may specialize these with SIMD kernels.
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::test(values[i], flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            if (::enumbra::has_any(values[i] & flags)) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, int* indices) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::has_any(values[i] & flags)) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    // Counts values that have every flag in all_of set and every flag in none_of unset.
+    template<class T>
+    constexpr int count_matching(const T* values, int count, T all_of, T none_of) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) { ++matches; }
+        }
+        return matches;
+    }
+
+    template<class T>
+    constexpr void set_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::set(values[i], flags); }
+    }
+
+    template<class T>
+    constexpr void unset_batch(T* values, int count, T flags) noexcept {
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) { ::enumbra::unset(values[i], flags); }
+    }
+
     // End Default Templates
 } // end namespace enumbra
 #else // check existing version supported
 #if (ENUMBRA_BASE_TEMPLATES_VERSION + 0) == 0
 #error ENUMBRA_BASE_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
-#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) < 31
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) < 35
 #error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
-#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) > 31
+#elif (ENUMBRA_BASE_TEMPLATES_VERSION + 0) > 35
 #error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
 #endif // check existing version supported
 #endif // ENUMBRA_BASE_TEMPLATES_VERSION
 
+
+#if !defined(ENUMBRA_SIMD_TEMPLATES_VERSION)
+#define ENUMBRA_SIMD_TEMPLATES_VERSION 1
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENUMBRA_SIMD_SSE2
+#if defined(__AVX2__)
+#define ENUMBRA_SIMD_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+namespace enumbra::detail::simd {
+    constexpr int popcount(unsigned int m) noexcept {
+        m = m - ((m >> 1) & 0x55555555u);
+        m = (m & 0x33333333u) + ((m >> 2) & 0x33333333u);
+        return static_cast<int>((((m + (m >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+    }
+
+    struct sse2 {
+        using vec = __m128i;
+        static constexpr int width = 16;
+        template<class T> static vec load(const T* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(p))); }
+        template<class T> static void store(T* p, vec v) noexcept { _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), v); }
+        static vec zero() noexcept { return _mm_setzero_si128(); }
+        static vec and_(vec a, vec b) noexcept { return _mm_and_si128(a, b); }
+        static vec or_(vec a, vec b) noexcept { return _mm_or_si128(a, b); }
+        static vec andnot(vec a, vec b) noexcept { return _mm_andnot_si128(a, b); }
+        template<class U> static vec broadcast(U v) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm_set1_epi8(static_cast<char>(v)); }
+            else if constexpr (sizeof(U) == 2) { return _mm_set1_epi16(static_cast<short>(v)); }
+            else if constexpr (sizeof(U) == 4) { return _mm_set1_epi32(static_cast<int>(v)); }
+            else { return _mm_set1_epi64x(static_cast<long long>(v)); }
+        }
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(U) == 2) { return _mm_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(U) == 4) { return _mm_cmpeq_epi32(a, b); }
+            else { const vec c = _mm_cmpeq_epi32(a, b); return _mm_and_si128(c, _mm_shuffle_epi32(c, 0xB1)); }
+        }
+        // One bit per lane of a comparison result
+        template<class U> static unsigned int lane_mask(vec m) noexcept {
+            if constexpr (sizeof(U) == 1) { return static_cast<unsigned int>(_mm_movemask_epi8(m)); }
+            else if constexpr (sizeof(U) == 2) { return static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()))); }
+            else if constexpr (sizeof(U) == 4) { return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+            else { return static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(m))); }
+        }
+    };
+
+#if defined(ENUMBRA_SIMD_AVX2)
+    struct avx2 {
+        using vec = __m256i;
+        static constexpr int width = 32;
+        template<class T> static vec load(const T* p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(p))); }
+        template<class T> static void store(T* p, vec v) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(p)), v); }
+        static vec zero() noexcept { return _mm256_setzero_si256(); }
+        static vec and_(vec a, vec b) noexcept { return _mm256_and_si256(a, b); }
+        static vec or_(vec a, vec b) noexcept { return _mm256_or_si256(a, b); }
+        static vec andnot(vec a, vec b) noexcept { return _mm256_andnot_si256(a, b); }
+        template<class U> static vec broadcast(U v) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm256_set1_epi8(static_cast<char>(v)); }
+            else if constexpr (sizeof(U) == 2) { return _mm256_set1_epi16(static_cast<short>(v)); }
+            else if constexpr (sizeof(U) == 4) { return _mm256_set1_epi32(static_cast<int>(v)); }
+            else { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+        }
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {
+            if constexpr (sizeof(U) == 1) { return _mm256_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(U) == 2) { return _mm256_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(U) == 4) { return _mm256_cmpeq_epi32(a, b); }
+            else { return _mm256_cmpeq_epi64(a, b); }
+        }
+        // One bit per lane of a comparison result. packs works per 128-bit half, so restore lane order.
+        template<class U> static unsigned int lane_mask(vec m) noexcept {
+            if constexpr (sizeof(U) == 1) { return static_cast<unsigned int>(_mm256_movemask_epi8(m)); }
+            else if constexpr (sizeof(U) == 2) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(m, _mm256_setzero_si256()), 0xD8))) & 0xFFFFu; }
+            else if constexpr (sizeof(U) == 4) { return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+            else { return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+        }
+    };
+    using best = avx2;
+#else
+    using best = sse2;
+#endif
+
+    // Kernels process whole vectors, then finish the tail with the per-value specializations.
+    // U is the underlying type of T, lanes always divides 64 so a vector never straddles a selection word.
+    template<class B, class T, class U, bool all>
+    inline typename B::vec test_vec(const T* values, typename B::vec f) noexcept {
+        return B::template cmpeq<U>(B::and_(B::load(values), f), all ? f : B::zero());
+    }
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) { m = ~m & lane_bits; }
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            selection[i / 64] |= static_cast<unsigned long long>(m) << (i % 64);
+            matches += popcount(m);
+        }
+        for (; i < count; ++i) {
+            if ((i % 64) == 0) { selection[i / 64] = 0; }
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) {
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, int* indices) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) { m = ~m & lane_bits; }
+            // Branchless compaction: always write, only advance on a match
+            for (int l = 0; l < lanes; ++l) {
+                indices[matches] = i + l;
+                matches += static_cast<int>((m >> l) & 1u);
+            }
+        }
+        for (; i < count; ++i) {
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) { indices[matches++] = i; }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U>
+    inline int count_matching(const T* values, int count, T all_of, T none_of) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec a = B::template broadcast<U>(static_cast<U>(all_of));
+        const typename B::vec n = B::template broadcast<U>(static_cast<U>(none_of));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            const typename B::vec v = B::load(values + i);
+            const typename B::vec has_all_of = B::template cmpeq<U>(B::and_(v, a), a);
+            const typename B::vec has_none_of = B::template cmpeq<U>(B::and_(v, n), B::zero());
+            matches += popcount(B::template lane_mask<U>(B::and_(has_all_of, has_none_of)));
+        }
+        for (; i < count; ++i) {
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) { ++matches; }
+        }
+        return matches;
+    }
+
+    template<class B, class T, class U, bool set>
+    inline void modify_batch(T* values, int count, T flags) noexcept {
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {
+            const typename B::vec v = B::load(values + i);
+            B::store(values + i, set ? B::or_(v, f) : B::andnot(f, v));
+        }
+        for (; i < count; ++i) {
+            if constexpr (set) { ::enumbra::set(values[i], flags); } else { ::enumbra::unset(values[i], flags); }
+        }
+    }
+} // end namespace enumbra::detail::simd
+#endif // SSE2 available
+#else // check existing version supported
+#if (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) == 0
+#error ENUMBRA_SIMD_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) < 1
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) > 1
+#error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
+#endif // check existing version supported
+#endif // ENUMBRA_SIMD_TEMPLATES_VERSION
+
 namespace enums {
 enum class test_string_parse : int64_t {
 C = -1,
@@ -394,7 +723,7 @@ template<> struct enumbra::detail::base_helper<::enums::test_string_parse> : enu
 template<> struct enumbra::detail::enum_helper<::enums::test_string_parse> : enumbra::detail::enum_info<int64_t, -1, 9223372036854775807, -1, 5, false, 64, 64, true, 0> { };
 
 namespace enums::detail::test_string_parse {
-constexpr ::enums::test_string_parse values_arr[5] =
+inline constexpr ::enums::test_string_parse values_arr[5] =
 {
 ::enums::test_string_parse::C,
 ::enums::test_string_parse::B,
@@ -402,7 +731,7 @@ constexpr ::enums::test_string_parse values_arr[5] =
 ::enums::test_string_parse::D,
 ::enums::test_string_parse::E,
 };
-constexpr const char enum_strings[11] = {
+inline constexpr const char enum_strings[11] = {
 "C\0"
 "B\0"
 "F\0"
@@ -495,20 +824,20 @@ template<> struct enumbra::detail::base_helper<::enums::Unsigned64Test> : enumbr
 template<> struct enumbra::detail::enum_helper<::enums::Unsigned64Test> : enumbra::detail::enum_info<uint64_t, 0, 0xFFFFFFFFFFFFFFFF, 0, 4, false, 64, 64, false, 0> { };
 
 namespace enums::detail::Unsigned64Test {
-constexpr ::enums::Unsigned64Test values_arr[4] =
+inline constexpr ::enums::Unsigned64Test values_arr[4] =
 {
 ::enums::Unsigned64Test::MIN,
 ::enums::Unsigned64Test::V_UINT16_MAX,
 ::enums::Unsigned64Test::V_UINT32_MAX,
 ::enums::Unsigned64Test::MAX,
 };
-constexpr const char enum_strings[35] = {
+inline constexpr const char enum_strings[35] = {
 "MIN\0"
 "MAX\0"
 "V_UINT16_MAX\0"
 "V_UINT32_MAX\0"
 };
-constexpr ::enums::Unsigned64Test enum_string_values[4] = {
+inline constexpr ::enums::Unsigned64Test enum_string_values[4] = {
 ::enums::Unsigned64Test::MIN,
 ::enums::Unsigned64Test::MAX,
 ::enums::Unsigned64Test::V_UINT16_MAX,
@@ -602,18 +931,18 @@ template<> struct enumbra::detail::base_helper<::enums::Signed64Test> : enumbra:
 template<> struct enumbra::detail::enum_helper<::enums::Signed64Test> : enumbra::detail::enum_info<int64_t, (-9223372036854775807 - 1), 9223372036854775807, (-9223372036854775807 - 1), 3, false, 64, 64, true, 0> { };
 
 namespace enums::detail::Signed64Test {
-constexpr ::enums::Signed64Test values_arr[3] =
+inline constexpr ::enums::Signed64Test values_arr[3] =
 {
 ::enums::Signed64Test::MIN,
 ::enums::Signed64Test::NEG_ONE,
 ::enums::Signed64Test::MAX,
 };
-constexpr const char enum_strings[17] = {
+inline constexpr const char enum_strings[17] = {
 "MIN\0"
 "MAX\0"
 "NEG_ONE\0"
 };
-constexpr ::enums::Signed64Test enum_string_values[3] = {
+inline constexpr ::enums::Signed64Test enum_string_values[3] = {
 ::enums::Signed64Test::MIN,
 ::enums::Signed64Test::MAX,
 ::enums::Signed64Test::NEG_ONE,
@@ -705,18 +1034,18 @@ template<> struct enumbra::detail::base_helper<::enums::Signed32Test> : enumbra:
 template<> struct enumbra::detail::enum_helper<::enums::Signed32Test> : enumbra::detail::enum_info<int32_t, (-2147483647 - 1), 2147483647, (-2147483647 - 1), 3, false, 32, 32, true, 0> { };
 
 namespace enums::detail::Signed32Test {
-constexpr ::enums::Signed32Test values_arr[3] =
+inline constexpr ::enums::Signed32Test values_arr[3] =
 {
 ::enums::Signed32Test::MIN,
 ::enums::Signed32Test::NEG_ONE,
 ::enums::Signed32Test::MAX,
 };
-constexpr const char enum_strings[17] = {
+inline constexpr const char enum_strings[17] = {
 "MIN\0"
 "MAX\0"
 "NEG_ONE\0"
 };
-constexpr ::enums::Signed32Test enum_string_values[3] = {
+inline constexpr ::enums::Signed32Test enum_string_values[3] = {
 ::enums::Signed32Test::MIN,
 ::enums::Signed32Test::MAX,
 ::enums::Signed32Test::NEG_ONE,
@@ -808,18 +1137,18 @@ template<> struct enumbra::detail::base_helper<::enums::Signed16Test> : enumbra:
 template<> struct enumbra::detail::enum_helper<::enums::Signed16Test> : enumbra::detail::enum_info<int16_t, (-32767 - 1), 32767, (-32767 - 1), 3, false, 16, 16, true, 0> { };
 
 namespace enums::detail::Signed16Test {
-constexpr ::enums::Signed16Test values_arr[3] =
+inline constexpr ::enums::Signed16Test values_arr[3] =
 {
 ::enums::Signed16Test::MIN,
 ::enums::Signed16Test::NEG_ONE,
 ::enums::Signed16Test::MAX,
 };
-constexpr const char enum_strings[17] = {
+inline constexpr const char enum_strings[17] = {
 "MIN\0"
 "MAX\0"
 "NEG_ONE\0"
 };
-constexpr ::enums::Signed16Test enum_string_values[3] = {
+inline constexpr ::enums::Signed16Test enum_string_values[3] = {
 ::enums::Signed16Test::MIN,
 ::enums::Signed16Test::MAX,
 ::enums::Signed16Test::NEG_ONE,
@@ -911,13 +1240,13 @@ template<> struct enumbra::detail::base_helper<::enums::Signed8Test> : enumbra::
 template<> struct enumbra::detail::enum_helper<::enums::Signed8Test> : enumbra::detail::enum_info<int8_t, (-127 - 1), 127, (-127 - 1), 3, false, 8, 8, true, 0> { };
 
 namespace enums::detail::Signed8Test {
-constexpr ::enums::Signed8Test values_arr[3] =
+inline constexpr ::enums::Signed8Test values_arr[3] =
 {
 ::enums::Signed8Test::V_INT_MIN,
 ::enums::Signed8Test::V_NEG_ONE,
 ::enums::Signed8Test::V_INT_MAX,
 };
-constexpr const char enum_strings[31] = {
+inline constexpr const char enum_strings[31] = {
 "V_INT_MIN\0"
 "V_NEG_ONE\0"
 "V_INT_MAX\0"
@@ -1005,13 +1334,13 @@ template<> struct enumbra::detail::base_helper<::enums::test_value> : enumbra::d
 template<> struct enumbra::detail::enum_helper<::enums::test_value> : enumbra::detail::enum_info<int32_t, 0, 2, 0, 3, true, 3, 2, true, -1> { };
 
 namespace enums::detail::test_value {
-constexpr ::enums::test_value values_arr[3] =
+inline constexpr ::enums::test_value values_arr[3] =
 {
 ::enums::test_value::A,
 ::enums::test_value::B,
 ::enums::test_value::C,
 };
-constexpr const char enum_strings[7] = {
+inline constexpr const char enum_strings[7] = {
 "A\0"
 "B\0"
 "C\0"
@@ -1097,7 +1426,7 @@ template<> struct enumbra::detail::base_helper<::enums::HexDiagonal> : enumbra::
 template<> struct enumbra::detail::enum_helper<::enums::HexDiagonal> : enumbra::detail::enum_info<uint8_t, 0, 5, 0, 6, true, 3, 3, true, 255> { };
 
 namespace enums::detail::HexDiagonal {
-constexpr ::enums::HexDiagonal values_arr[6] =
+inline constexpr ::enums::HexDiagonal values_arr[6] =
 {
 ::enums::HexDiagonal::NORTH,
 ::enums::HexDiagonal::NORTH_EAST,
@@ -1106,7 +1435,7 @@ constexpr ::enums::HexDiagonal values_arr[6] =
 ::enums::HexDiagonal::SOUTH_WEST,
 ::enums::HexDiagonal::NORTH_WEST,
 };
-constexpr const char enum_strings[57] = {
+inline constexpr const char enum_strings[57] = {
 "NORTH\0"
 "SOUTH\0"
 "NORTH_EAST\0"
@@ -1114,7 +1443,7 @@ constexpr const char enum_strings[57] = {
 "SOUTH_WEST\0"
 "NORTH_WEST\0"
 };
-constexpr ::enums::HexDiagonal enum_string_values[6] = {
+inline constexpr ::enums::HexDiagonal enum_string_values[6] = {
 ::enums::HexDiagonal::NORTH,
 ::enums::HexDiagonal::SOUTH,
 ::enums::HexDiagonal::NORTH_EAST,
@@ -1208,14 +1537,14 @@ template<> struct enumbra::detail::base_helper<::enums::NegativeTest1> : enumbra
 template<> struct enumbra::detail::enum_helper<::enums::NegativeTest1> : enumbra::detail::enum_info<int8_t, -2, 1, -2, 4, true, 2, 2, false, 0> { };
 
 namespace enums::detail::NegativeTest1 {
-constexpr ::enums::NegativeTest1 values_arr[4] =
+inline constexpr ::enums::NegativeTest1 values_arr[4] =
 {
 ::enums::NegativeTest1::A,
 ::enums::NegativeTest1::B,
 ::enums::NegativeTest1::C,
 ::enums::NegativeTest1::D,
 };
-constexpr const char enum_strings[9] = {
+inline constexpr const char enum_strings[9] = {
 "A\0"
 "B\0"
 "C\0"
@@ -1301,14 +1630,14 @@ template<> struct enumbra::detail::base_helper<::enums::NegativeTest2> : enumbra
 template<> struct enumbra::detail::enum_helper<::enums::NegativeTest2> : enumbra::detail::enum_info<int8_t, -3, 0, -3, 4, true, 3, 2, false, 0> { };
 
 namespace enums::detail::NegativeTest2 {
-constexpr ::enums::NegativeTest2 values_arr[4] =
+inline constexpr ::enums::NegativeTest2 values_arr[4] =
 {
 ::enums::NegativeTest2::A,
 ::enums::NegativeTest2::B,
 ::enums::NegativeTest2::C,
 ::enums::NegativeTest2::D,
 };
-constexpr const char enum_strings[9] = {
+inline constexpr const char enum_strings[9] = {
 "A\0"
 "B\0"
 "C\0"
@@ -1392,12 +1721,12 @@ template<> struct enumbra::detail::base_helper<::enums::NegativeTest3> : enumbra
 template<> struct enumbra::detail::enum_helper<::enums::NegativeTest3> : enumbra::detail::enum_info<int8_t, -3, 4, -3, 2, false, 4, 3, true, 0> { };
 
 namespace enums::detail::NegativeTest3 {
-constexpr ::enums::NegativeTest3 values_arr[2] =
+inline constexpr ::enums::NegativeTest3 values_arr[2] =
 {
 ::enums::NegativeTest3::A,
 ::enums::NegativeTest3::B,
 };
-constexpr const char enum_strings[5] = {
+inline constexpr const char enum_strings[5] = {
 "A\0"
 "B\0"
 };
@@ -1482,12 +1811,12 @@ template<> struct enumbra::detail::base_helper<::enums::NegativeTest4> : enumbra
 template<> struct enumbra::detail::enum_helper<::enums::NegativeTest4> : enumbra::detail::enum_info<int8_t, -4, 3, -4, 2, false, 3, 3, true, 0> { };
 
 namespace enums::detail::NegativeTest4 {
-constexpr ::enums::NegativeTest4 values_arr[2] =
+inline constexpr ::enums::NegativeTest4 values_arr[2] =
 {
 ::enums::NegativeTest4::A,
 ::enums::NegativeTest4::B,
 };
-constexpr const char enum_strings[5] = {
+inline constexpr const char enum_strings[5] = {
 "A\0"
 "B\0"
 };
@@ -1571,7 +1900,7 @@ template<> struct enumbra::detail::base_helper<::enums::EmptyTest1Unsigned> : en
 template<> struct enumbra::detail::enum_helper<::enums::EmptyTest1Unsigned> : enumbra::detail::enum_info<uint8_t, 0, 0, 0, 1, true, 1, 0, true, 255> { };
 
 namespace enums::detail::EmptyTest1Unsigned {
-constexpr ::enums::EmptyTest1Unsigned values_arr[1] =
+inline constexpr ::enums::EmptyTest1Unsigned values_arr[1] =
 {
 ::enums::EmptyTest1Unsigned::A,
 };
@@ -1643,7 +1972,7 @@ template<> struct enumbra::detail::base_helper<::enums::EmptyTest1Signed> : enum
 template<> struct enumbra::detail::enum_helper<::enums::EmptyTest1Signed> : enumbra::detail::enum_info<int8_t, 0, 0, 0, 1, true, 1, 0, true, -1> { };
 
 namespace enums::detail::EmptyTest1Signed {
-constexpr ::enums::EmptyTest1Signed values_arr[1] =
+inline constexpr ::enums::EmptyTest1Signed values_arr[1] =
 {
 ::enums::EmptyTest1Signed::A,
 };
@@ -1715,7 +2044,7 @@ template<> struct enumbra::detail::base_helper<::enums::SingleTest1Unsigned> : e
 template<> struct enumbra::detail::enum_helper<::enums::SingleTest1Unsigned> : enumbra::detail::enum_info<uint8_t, 4, 4, 4, 1, true, 3, 0, true, 0> { };
 
 namespace enums::detail::SingleTest1Unsigned {
-constexpr ::enums::SingleTest1Unsigned values_arr[1] =
+inline constexpr ::enums::SingleTest1Unsigned values_arr[1] =
 {
 ::enums::SingleTest1Unsigned::A,
 };
@@ -1787,7 +2116,7 @@ template<> struct enumbra::detail::base_helper<::enums::SingleTest1Signed> : enu
 template<> struct enumbra::detail::enum_helper<::enums::SingleTest1Signed> : enumbra::detail::enum_info<int8_t, 4, 4, 4, 1, true, 4, 0, true, 0> { };
 
 namespace enums::detail::SingleTest1Signed {
-constexpr ::enums::SingleTest1Signed values_arr[1] =
+inline constexpr ::enums::SingleTest1Signed values_arr[1] =
 {
 ::enums::SingleTest1Signed::A,
 };
@@ -1936,7 +2265,7 @@ template<> struct enumbra::detail::base_helper<::enums::errc> : enumbra::detail:
 template<> struct enumbra::detail::enum_helper<::enums::errc> : enumbra::detail::enum_info<int32_t, 1, 140, 1, 78, false, 9, 8, true, 0> { };
 
 namespace enums::detail::errc {
-constexpr ::enums::errc values_arr[78] =
+inline constexpr ::enums::errc values_arr[78] =
 {
 ::enums::errc::operation_not_permitted,
 ::enums::errc::no_such_file_or_directory,
@@ -2017,7 +2346,7 @@ constexpr ::enums::errc values_arr[78] =
 ::enums::errc::text_file_busy,
 ::enums::errc::operation_would_block,
 };
-constexpr const char enum_strings[1469] = {
+inline constexpr const char enum_strings[1469] = {
 "no_link\0"
 "io_error\0"
 "timed_out\0"
@@ -2097,7 +2426,7 @@ constexpr const char enum_strings[1469] = {
 "connection_already_in_progress\0"
 "inappropriate_io_control_operation\0"
 };
-constexpr ::enums::errc enum_string_values[78] = {
+inline constexpr ::enums::errc enum_string_values[78] = {
 ::enums::errc::no_link,
 ::enums::errc::io_error,
 ::enums::errc::timed_out,
@@ -2347,6 +2676,82 @@ return ::enumbra::from_string<::enums::errc>(str, len);
 }
 
 
+namespace enums {
+enum class OutOfLineTest : int32_t {
+Sun = 0,
+Moon = 1,
+Earth = 2,
+Venus = 3,
+Saturn = 4,
+Mercury = 5,
+Jupiter = 6,
+Neptune = 7,
+};
+}
+
+template<> struct enumbra::detail::base_helper<::enums::OutOfLineTest> : enumbra::detail::type_info<true, true, false> { };
+template<> struct enumbra::detail::enum_helper<::enums::OutOfLineTest> : enumbra::detail::enum_info<int32_t, 0, 7, 0, 8, true, 4, 3, true, -1> { };
+
+namespace enums::detail::OutOfLineTest {
+inline constexpr ::enums::OutOfLineTest values_arr[8] =
+{
+::enums::OutOfLineTest::Sun,
+::enums::OutOfLineTest::Moon,
+::enums::OutOfLineTest::Earth,
+::enums::OutOfLineTest::Venus,
+::enums::OutOfLineTest::Saturn,
+::enums::OutOfLineTest::Mercury,
+::enums::OutOfLineTest::Jupiter,
+::enums::OutOfLineTest::Neptune,
+};
+}
+
+template<>
+constexpr auto& enumbra::values<::enums::OutOfLineTest>() noexcept
+{
+return ::enums::detail::OutOfLineTest::values_arr;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_integer<::enums::OutOfLineTest>(int32_t v) noexcept { 
+if((0 <= v) && (v <= 7)) { return ::enumbra::optional_value<::enums::OutOfLineTest>(static_cast<::enums::OutOfLineTest>(v)); }
+return {};
+}
+
+template<>
+constexpr bool ::enumbra::is_valid<::enums::OutOfLineTest>(::enums::OutOfLineTest e) noexcept { 
+return (0 <= static_cast<int32_t>(e)) && (static_cast<int32_t>(e) <= 7);
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name<::enums::OutOfLineTest>() noexcept { 
+return { "OutOfLineTest", 13 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_name_with_namespace<::enums::OutOfLineTest>() noexcept { 
+return { "enums::OutOfLineTest", 20 };
+}
+
+template<>
+constexpr ::enumbra::string_view enumbra::enum_namespace<::enums::OutOfLineTest>() noexcept { 
+return { "enums", 5 };
+}
+
+namespace enumbra {
+::enumbra::string_view to_string(const ::enums::OutOfLineTest v) noexcept;
+}
+
+template<>
+::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_string<::enums::OutOfLineTest>(const char* str, int len) noexcept;
+
+template<>
+inline ::enumbra::optional_value<::enums::OutOfLineTest> enumbra::from_string<::enums::OutOfLineTest>(const char* str) noexcept {
+const int len = ::enumbra::detail::strlen(str);
+return ::enumbra::from_string<::enums::OutOfLineTest>(str, len);
+}
+
+
 
 namespace enums {
 enum class test_flags : uint32_t {
@@ -2355,7 +2760,7 @@ C = 2,
 };
 
 namespace detail::test_flags {
-constexpr ::enums::test_flags flags_arr[2] =
+inline constexpr ::enums::test_flags flags_arr[2] =
 {
 ::enums::test_flags::B,
 ::enums::test_flags::C,
@@ -2386,6 +2791,21 @@ template<> constexpr bool has_any(::enums::test_flags value) noexcept { return (
 template<> constexpr bool has_none(::enums::test_flags value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x3)) == 0; }
 template<> constexpr bool has_single(::enums::test_flags value) noexcept { uint32_t n = static_cast<uint32_t>(static_cast<uint32_t>(value) & 0x3); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::test_flags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x3) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::test_flags flag_from_index<::enums::test_flags>(int index) noexcept { return (index >= 0 && index < 2) ? static_cast<::enums::test_flags>(1ULL << (index + 0)) : ::enums::test_flags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::test_flags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x3) == 0x3)
+;
+}
+
+template<>
+constexpr ::enums::test_flags closure(::enums::test_flags value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::test_flags> : enumbra::detail::type_info<true, false, true> { };
@@ -2443,6 +2863,16 @@ constexpr ::enumbra::optional_value<::enums::test_flags> from_string<::enums::te
     const int len = ::enumbra::detail::strlen(str);
     return ::enumbra::from_string<::enums::test_flags>(str, len);
 }
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::test_flags>(const ::enums::test_flags* values, int count, ::enums::test_flags all_of, ::enums::test_flags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::test_flags>(::enums::test_flags* values, int count, ::enums::test_flags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::test_flags>(::enums::test_flags* values, int count, ::enums::test_flags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_flags, uint32_t, false>(values, count, flags); }
+#endif
 } // namespace enumbra
 
 namespace enums {
@@ -2452,7 +2882,7 @@ C = 2,
 };
 
 namespace detail::test_nodefault {
-constexpr ::enums::test_nodefault flags_arr[2] =
+inline constexpr ::enums::test_nodefault flags_arr[2] =
 {
 ::enums::test_nodefault::B,
 ::enums::test_nodefault::C,
@@ -2483,6 +2913,21 @@ template<> constexpr bool has_any(::enums::test_nodefault value) noexcept { retu
 template<> constexpr bool has_none(::enums::test_nodefault value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x3)) == 0; }
 template<> constexpr bool has_single(::enums::test_nodefault value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x3); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::test_nodefault flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x3) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::test_nodefault flag_from_index<::enums::test_nodefault>(int index) noexcept { return (index >= 0 && index < 2) ? static_cast<::enums::test_nodefault>(1ULL << (index + 0)) : ::enums::test_nodefault(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::test_nodefault value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x3) == 0x3)
+;
+}
+
+template<>
+constexpr ::enums::test_nodefault closure(::enums::test_nodefault value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::test_nodefault> : enumbra::detail::type_info<true, false, true> { };
@@ -2540,6 +2985,16 @@ constexpr ::enumbra::optional_value<::enums::test_nodefault> from_string<::enums
     const int len = ::enumbra::detail::strlen(str);
     return ::enumbra::from_string<::enums::test_nodefault>(str, len);
 }
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::test_nodefault>(const ::enums::test_nodefault* values, int count, ::enums::test_nodefault all_of, ::enums::test_nodefault none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::test_nodefault>(::enums::test_nodefault* values, int count, ::enums::test_nodefault flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::test_nodefault>(::enums::test_nodefault* values, int count, ::enums::test_nodefault flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::test_nodefault, uint16_t, false>(values, count, flags); }
+#endif
 } // namespace enumbra
 
 namespace enums {
@@ -2550,12 +3005,13 @@ D = 16,
 };
 
 namespace detail::TestSparseFlags {
-constexpr ::enums::TestSparseFlags flags_arr[3] =
+inline constexpr ::enums::TestSparseFlags flags_arr[3] =
 {
 ::enums::TestSparseFlags::B,
 ::enums::TestSparseFlags::C,
 ::enums::TestSparseFlags::D,
 };
+inline constexpr signed char flag_bit_index[5] = { 0, -1, 1, -1, 2 };
 }
 
 } // namespace enums
@@ -2582,6 +3038,21 @@ template<> constexpr bool has_any(::enums::TestSparseFlags value) noexcept { ret
 template<> constexpr bool has_none(::enums::TestSparseFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x15)) == 0; }
 template<> constexpr bool has_single(::enums::TestSparseFlags value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x15); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::TestSparseFlags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return (n != 0 && (n & (n - 1)) == 0 && n <= 0x15) ? ::enums::detail::TestSparseFlags::flag_bit_index[::enumbra::detail::countr_zero(n)] : -1; }
+template<> constexpr ::enums::TestSparseFlags flag_from_index<::enums::TestSparseFlags>(int index) noexcept { return (index >= 0 && index < 3) ? ::enums::detail::TestSparseFlags::flags_arr[index] : ::enums::TestSparseFlags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestSparseFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x15) == 0x15)
+;
+}
+
+template<>
+constexpr ::enums::TestSparseFlags closure(::enums::TestSparseFlags value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::TestSparseFlags> : enumbra::detail::type_info<true, false, true> { };
@@ -2644,6 +3115,16 @@ constexpr ::enumbra::optional_value<::enums::TestSparseFlags> from_string<::enum
     const int len = ::enumbra::detail::strlen(str);
     return ::enumbra::from_string<::enums::TestSparseFlags>(str, len);
 }
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestSparseFlags>(const ::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags all_of, ::enums::TestSparseFlags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestSparseFlags>(::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestSparseFlags>(::enums::TestSparseFlags* values, int count, ::enums::TestSparseFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSparseFlags, uint16_t, false>(values, count, flags); }
+#endif
 } // namespace enumbra
 
 namespace enums {
@@ -2652,7 +3133,7 @@ C = 4,
 };
 
 namespace detail::TestSingleFlag {
-constexpr ::enums::TestSingleFlag flags_arr[1] =
+inline constexpr ::enums::TestSingleFlag flags_arr[1] =
 {
 ::enums::TestSingleFlag::C,
 };
@@ -2682,6 +3163,21 @@ template<> constexpr bool has_any(::enums::TestSingleFlag value) noexcept { retu
 template<> constexpr bool has_none(::enums::TestSingleFlag value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x4)) == 0; }
 template<> constexpr bool has_single(::enums::TestSingleFlag value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x4); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::TestSingleFlag flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x4 && n <= 0x4) ? (::enumbra::detail::countr_zero(n) - 2) : -1; }
+template<> constexpr ::enums::TestSingleFlag flag_from_index<::enums::TestSingleFlag>(int index) noexcept { return (index >= 0 && index < 1) ? static_cast<::enums::TestSingleFlag>(1ULL << (index + 2)) : ::enums::TestSingleFlag(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestSingleFlag value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x4) == 0x4)
+;
+}
+
+template<>
+constexpr ::enums::TestSingleFlag closure(::enums::TestSingleFlag value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::TestSingleFlag> : enumbra::detail::type_info<true, false, true> { };
@@ -2734,6 +3230,16 @@ constexpr ::enumbra::optional_value<::enums::TestSingleFlag> from_string<::enums
     const int len = ::enumbra::detail::strlen(str);
     return ::enumbra::from_string<::enums::TestSingleFlag>(str, len);
 }
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestSingleFlag>(const ::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag all_of, ::enums::TestSingleFlag none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestSingleFlag>(::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestSingleFlag>(::enums::TestSingleFlag* values, int count, ::enums::TestSingleFlag flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestSingleFlag, uint16_t, false>(values, count, flags); }
+#endif
 } // namespace enumbra
 
 namespace enums {
@@ -2744,7 +3250,7 @@ biggest = 4,
 };
 
 namespace detail::Blorp {
-constexpr ::enums::Blorp flags_arr[3] =
+inline constexpr ::enums::Blorp flags_arr[3] =
 {
 ::enums::Blorp::big,
 ::enums::Blorp::bigger,
@@ -2776,6 +3282,21 @@ template<> constexpr bool has_any(::enums::Blorp value) noexcept { return (stati
 template<> constexpr bool has_none(::enums::Blorp value) noexcept { return (static_cast<uint32_t>(value) & static_cast<uint32_t>(0x7)) == 0; }
 template<> constexpr bool has_single(::enums::Blorp value) noexcept { uint32_t n = static_cast<uint32_t>(static_cast<uint32_t>(value) & 0x7); return n && !(n & (n - 1)); }
 
+template<> constexpr int flag_index(::enums::Blorp flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= 0x1 && n <= 0x7) ? (::enumbra::detail::countr_zero(n) - 0) : -1; }
+template<> constexpr ::enums::Blorp flag_from_index<::enums::Blorp>(int index) noexcept { return (index >= 0 && index < 3) ? static_cast<::enums::Blorp>(1ULL << (index + 0)) : ::enums::Blorp(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::Blorp value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x7) == 0x7)
+;
+}
+
+template<>
+constexpr ::enums::Blorp closure(::enums::Blorp value) noexcept {
+return value;
+}
+
 } // namespace enumbra
 
 template<> struct enumbra::detail::base_helper<::enums::Blorp> : enumbra::detail::type_info<true, false, true> { };
@@ -2844,6 +3365,224 @@ constexpr ::enumbra::optional_value<::enums::Blorp> from_string<::enums::Blorp>(
     const int len = ::enumbra::detail::strlen(str);
     return ::enumbra::from_string<::enums::Blorp>(str, len);
 }
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::Blorp>(const ::enums::Blorp* values, int count, ::enums::Blorp all_of, ::enums::Blorp none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::Blorp>(::enums::Blorp* values, int count, ::enums::Blorp flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::Blorp>(::enums::Blorp* values, int count, ::enums::Blorp flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::Blorp, uint32_t, false>(values, count, flags); }
+#endif
+} // namespace enumbra
+
+namespace enums {
+enum class TestConstrainedFlags : uint16_t {
+COMPRESS_NONE = 1,
+COMPRESS_LZ4 = 2,
+COMPRESS_ZSTD = 4,
+ENCRYPTED = 8,
+SIGNED = 16,
+CHECKSUMMED = 32,
+STREAMING = 64,
+BUFFERED = 0x200,
+};
+
+namespace detail::TestConstrainedFlags {
+inline constexpr ::enums::TestConstrainedFlags flags_arr[8] =
+{
+::enums::TestConstrainedFlags::COMPRESS_NONE,
+::enums::TestConstrainedFlags::COMPRESS_LZ4,
+::enums::TestConstrainedFlags::COMPRESS_ZSTD,
+::enums::TestConstrainedFlags::ENCRYPTED,
+::enums::TestConstrainedFlags::SIGNED,
+::enums::TestConstrainedFlags::CHECKSUMMED,
+::enums::TestConstrainedFlags::STREAMING,
+::enums::TestConstrainedFlags::BUFFERED,
+};
+inline constexpr signed char flag_bit_index[10] = { 0, 1, 2, 3, 4, 5, 6, -1, -1, 7 };
+inline constexpr uint16_t closure_table_0[256] = { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 };
+inline constexpr uint16_t closure_table_1[256] = { 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0, 0x30, 0x30 };
+}
+
+namespace presets::TestConstrainedFlags {
+inline constexpr ::enums::TestConstrainedFlags VERIFIED = static_cast<::enums::TestConstrainedFlags>(0x30);
+inline constexpr ::enums::TestConstrainedFlags SECURE = static_cast<::enums::TestConstrainedFlags>(0x38);
+}
+
+} // namespace enums
+
+namespace enumbra {
+template<>
+constexpr auto& flags<::enums::TestConstrainedFlags>() noexcept
+{
+return ::enums::detail::TestConstrainedFlags::flags_arr;
+}
+
+template<>
+constexpr bool is_valid<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags e) noexcept { 
+return (static_cast<uint16_t>(e) | static_cast<uint16_t>(0x27f)) == static_cast<uint16_t>(0x27f);
+}
+
+template<> constexpr void clear(::enums::TestConstrainedFlags& value) noexcept { value = static_cast<::enums::TestConstrainedFlags>(0); }
+template<> constexpr bool test(::enums::TestConstrainedFlags value, ::enums::TestConstrainedFlags flags) noexcept { return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(value)) == static_cast<uint16_t>(flags); }
+template<> constexpr void set(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) | static_cast<uint16_t>(flags)); }
+template<> constexpr void unset(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) & (~static_cast<uint16_t>(flags))); }
+template<> constexpr void toggle(::enums::TestConstrainedFlags& value, ::enums::TestConstrainedFlags flags) noexcept { value = static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(value) ^ static_cast<uint16_t>(flags)); }
+template<> constexpr bool has_all(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) == static_cast<uint16_t>(0x27f); }
+template<> constexpr bool has_any(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) > 0; }
+template<> constexpr bool has_none(::enums::TestConstrainedFlags value) noexcept { return (static_cast<uint16_t>(value) & static_cast<uint16_t>(0x27f)) == 0; }
+template<> constexpr bool has_single(::enums::TestConstrainedFlags value) noexcept { uint16_t n = static_cast<uint16_t>(static_cast<uint16_t>(value) & 0x27f); return n && !(n & (n - 1)); }
+
+template<> constexpr int flag_index(::enums::TestConstrainedFlags flag) noexcept { const unsigned long long n = static_cast<unsigned long long>(flag); return (n != 0 && (n & (n - 1)) == 0 && n <= 0x27f) ? ::enums::detail::TestConstrainedFlags::flag_bit_index[::enumbra::detail::countr_zero(n)] : -1; }
+template<> constexpr ::enums::TestConstrainedFlags flag_from_index<::enums::TestConstrainedFlags>(int index) noexcept { return (index >= 0 && index < 8) ? ::enums::detail::TestConstrainedFlags::flags_arr[index] : ::enums::TestConstrainedFlags(); }
+
+template<>
+constexpr bool satisfies_constraints(::enums::TestConstrainedFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return ((n | 0x27f) == 0x27f)
+&& (::enumbra::detail::popcount(n & 0x7) == 1)
+&& (::enumbra::detail::popcount(n & 0x240) <= 1)
+&& (((n & 0x8) == 0) || ((n & 0x10) == 0x10))
+&& (((n & 0x200) == 0) || ((n & 0x10) == 0x10))
+&& (((n & 0x10) == 0) || ((n & 0x20) == 0x20))
+;
+}
+
+template<>
+constexpr ::enums::TestConstrainedFlags closure(::enums::TestConstrainedFlags value) noexcept {
+const unsigned long long n = static_cast<unsigned long long>(value);
+return static_cast<::enums::TestConstrainedFlags>(n | ::enums::detail::TestConstrainedFlags::closure_table_0[(n >> 0) & 0xFF] | ::enums::detail::TestConstrainedFlags::closure_table_1[(n >> 8) & 0xFF]);
+}
+
+} // namespace enumbra
+
+template<> struct enumbra::detail::base_helper<::enums::TestConstrainedFlags> : enumbra::detail::type_info<true, false, true> { };
+template<> struct enumbra::detail::enum_helper<::enums::TestConstrainedFlags> : enumbra::detail::enum_info<uint16_t, 0, 0x27F, 0, 8, false, 10, 10, false, 0> { };
+
+namespace enums {
+constexpr ::enums::TestConstrainedFlags operator~(const ::enums::TestConstrainedFlags a) noexcept { return static_cast<::enums::TestConstrainedFlags>(~static_cast<uint16_t>(a)); }
+constexpr ::enums::TestConstrainedFlags operator|(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags operator&(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) & static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags operator^(const ::enums::TestConstrainedFlags a, const ::enums::TestConstrainedFlags b) noexcept { return static_cast<::enums::TestConstrainedFlags>(static_cast<uint16_t>(a) ^ static_cast<uint16_t>(b)); }
+constexpr ::enums::TestConstrainedFlags& operator|=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a | b; }
+constexpr ::enums::TestConstrainedFlags& operator&=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a & b; }
+constexpr ::enums::TestConstrainedFlags& operator^=(::enums::TestConstrainedFlags& a, const ::enums::TestConstrainedFlags b) noexcept { return a = a ^ b; }
+} // namespace enums
+
+namespace enumbra {
+
+constexpr ::enumbra::stack_string<108> to_string(const ::enums::TestConstrainedFlags v) noexcept {
+::enumbra::stack_string<108> output;
+const unsigned long long value = static_cast<unsigned long long>(v);
+unsigned long long remaining = value;
+if (((value & 0x38) == 0x38) && ((remaining & 0x38) != 0)) {
+if (!output.empty()) { output.append('|'); }
+output.append<6>("SECURE");
+remaining &= ~0x38ULL;
+}
+if (((value & 0x30) == 0x30) && ((remaining & 0x30) != 0)) {
+if (!output.empty()) { output.append('|'); }
+output.append<8>("VERIFIED");
+remaining &= ~0x30ULL;
+}
+if ((remaining & 0x1) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<13>("COMPRESS_NONE");
+}
+if ((remaining & 0x2) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<12>("COMPRESS_LZ4");
+}
+if ((remaining & 0x4) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<13>("COMPRESS_ZSTD");
+}
+if ((remaining & 0x8) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<9>("ENCRYPTED");
+}
+if ((remaining & 0x10) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<6>("SIGNED");
+}
+if ((remaining & 0x20) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<11>("CHECKSUMMED");
+}
+if ((remaining & 0x40) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<9>("STREAMING");
+}
+if ((remaining & 0x200) != 0) {
+if (!output.empty()) { output.append('|'); }
+output.append<8>("BUFFERED");
+}
+return output;
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestConstrainedFlags> from_string<::enums::TestConstrainedFlags>(const char* str, int len) noexcept {
+if (len < 0) { return {}; } // Invalid size
+const char* start = str;
+const char* end = start;
+::enums::TestConstrainedFlags output = {};
+for (int i = 0; i < len; ++i) {
+if (str[i] == '\0') { return {}; } // Invalid: null in string
+end++;
+if ((i == (len - 1)) || (*end == '|')) {
+const auto check_len = end - start;
+if (check_len == 6) {
+if (::enumbra::detail::streq_fixed_size<6>(start, "SECURE")) { output |= ::enums::presets::TestConstrainedFlags::SECURE; }
+else if (::enumbra::detail::streq_fixed_size<6>(start, "SIGNED")) { output |= ::enums::TestConstrainedFlags::SIGNED; }
+else { return {}; }
+}
+else if (check_len == 8) {
+if (::enumbra::detail::streq_fixed_size<8>(start, "BUFFERED")) { output |= ::enums::TestConstrainedFlags::BUFFERED; }
+else if (::enumbra::detail::streq_fixed_size<8>(start, "VERIFIED")) { output |= ::enums::presets::TestConstrainedFlags::VERIFIED; }
+else { return {}; }
+}
+else if (check_len == 9) {
+if (::enumbra::detail::streq_fixed_size<9>(start, "ENCRYPTED")) { output |= ::enums::TestConstrainedFlags::ENCRYPTED; }
+else if (::enumbra::detail::streq_fixed_size<9>(start, "STREAMING")) { output |= ::enums::TestConstrainedFlags::STREAMING; }
+else { return {}; }
+}
+else if (check_len == 11) {
+if (::enumbra::detail::streq_fixed_size<11>(start, "CHECKSUMMED")) { output |= ::enums::TestConstrainedFlags::CHECKSUMMED; }
+else { return {}; }
+}
+else if (check_len == 12) {
+if (::enumbra::detail::streq_fixed_size<12>(start, "COMPRESS_LZ4")) { output |= ::enums::TestConstrainedFlags::COMPRESS_LZ4; }
+else { return {}; }
+}
+else if (check_len == 13) {
+if (::enumbra::detail::streq_fixed_size<13>(start, "COMPRESS_NONE")) { output |= ::enums::TestConstrainedFlags::COMPRESS_NONE; }
+else if (::enumbra::detail::streq_fixed_size<13>(start, "COMPRESS_ZSTD")) { output |= ::enums::TestConstrainedFlags::COMPRESS_ZSTD; }
+else { return {}; }
+}
+else { return {}; }
+start = end + 1;
+}
+}
+return ::enumbra::optional_value<::enums::TestConstrainedFlags>(output);
+}
+
+template<>
+constexpr ::enumbra::optional_value<::enums::TestConstrainedFlags> from_string<::enums::TestConstrainedFlags>(const char* str) noexcept {
+    const int len = ::enumbra::detail::strlen(str);
+    return ::enumbra::from_string<::enums::TestConstrainedFlags>(str, len);
+}
+
+#if defined(ENUMBRA_SIMD_SSE2)
+template<> inline int test_all_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags, selection); }
+template<> inline int test_all_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags, indices); }
+template<> inline int test_any_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, unsigned long long* selection) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags, selection); }
+template<> inline int test_any_batch<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags, int* indices) noexcept { return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags, indices); }
+template<> inline int count_matching<::enums::TestConstrainedFlags>(const ::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags all_of, ::enums::TestConstrainedFlags none_of) noexcept { return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t>(values, count, all_of, none_of); }
+template<> inline void set_batch<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, true>(values, count, flags); }
+template<> inline void unset_batch<::enums::TestConstrainedFlags>(::enums::TestConstrainedFlags* values, int count, ::enums::TestConstrainedFlags flags) noexcept { ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::sse2, ::enums::TestConstrainedFlags, uint16_t, false>(values, count, flags); }
+#endif
 } // namespace enumbra
 
-#endif // ENUMBRA_330E78AF79EDD327_H
+#endif // ENUMBRA_5792ACFBE51CAA08_H
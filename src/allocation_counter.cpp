@@ -0,0 +1,43 @@
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+// Replaces the global allocation functions to count allocations. The array and nothrow forms forward to these by default.
+// Only linked into the executables, libenumbra must not replace the allocator of the processes it is loaded into.
+void *operator new(std::size_t size) {
+    count_allocation(size);
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    count_allocation(size);
+    const auto align = static_cast<std::size_t>(alignment);
+#if defined(_WIN32)
+    void *p = _aligned_malloc(size ? size : 1, align);
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment
+    void *p = std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align);
+#endif
+    if (p) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+#if defined(_WIN32)
+void operator delete(void *p, std::align_val_t) noexcept { _aligned_free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Heap allocations made through the global operator new since the start of the process.
+// Counting is process-wide and relaxed, take the difference of two snapshots to measure a phase.
+// Allocations are only counted when allocation_counter.cpp, which replaces operator new, is linked into the executable.
+// Otherwise, e.g. in programs using libenumbra, all counts stay 0.
+struct allocation_stats {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+allocation_stats get_allocation_stats();
+
+// Same for the calling thread only, so phases running in parallel can be measured separately
+allocation_stats get_thread_allocation_stats();
+
+// Called by the replaced operator new
+void count_allocation(std::size_t size);
+
+inline allocation_stats operator-(const allocation_stats &lhs, const allocation_stats &rhs) {
+    return {lhs.count - rhs.count, lhs.bytes - rhs.bytes};
+}
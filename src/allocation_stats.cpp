@@ -0,0 +1,24 @@
+#include "allocation_counter.h"
+
+#include <atomic>
+
+namespace {
+    std::atomic<uint64_t> allocation_count{0};
+    std::atomic<uint64_t> allocation_bytes{0};
+    thread_local allocation_stats thread_allocations;
+}
+
+void count_allocation(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    thread_allocations.count++;
+    thread_allocations.bytes += size;
+}
+
+allocation_stats get_allocation_stats() {
+    return {allocation_count.load(std::memory_order_relaxed), allocation_bytes.load(std::memory_order_relaxed)};
+}
+
+allocation_stats get_thread_allocation_stats() {
+    return thread_allocations;
+}
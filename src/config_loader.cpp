@@ -0,0 +1,793 @@
+#include "config_loader.h"
+#include "mapped_file.h"
+#include "profiler.h"
+#include <charconv>
+#include <optional>
+#include <fmt/format.h>
+
+namespace {
+    bool contains_whitespace(const std::string_view str)
+    {
+        for(auto& s : str) {
+            if(std::isspace(s)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Moves a string out of the parsed document instead of copying it, the document is discarded after loading.
+    // Non-strings throw the same type_error as get<std::string>().
+    std::string take_string(json &value)
+    {
+        if (value.is_string()) {
+            return std::move(value.get_ref<std::string &>());
+        }
+        return value.get<std::string>();
+    }
+
+    // Group names are used as file names for sharded output
+    std::string parse_enum_group(const json &enum_cfg)
+    {
+        std::string group = enum_cfg.value("group", "");
+        for (const char c : group) {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') {
+                throw std::logic_error("enum group may only contain a-z, A-Z, 0-9 and underscores: " + group);
+            }
+        }
+        return group;
+    }
+
+    // An element of an "entries" array. Fields keep the JSON type they had in the schema, so loading reports
+    // the same errors whether the schema was streamed or parsed into a document first.
+    struct schema_entry {
+        json::value_t type = json::value_t::object; // Type of the element, only objects have fields
+        json::value_t name_type = json::value_t::null; // null if missing
+        std::string name;
+        bool has_description = false;
+        json::value_t description_type = json::value_t::null;
+        std::string description;
+        json::value_t value_type = json::value_t::null; // null if missing
+        std::string value_string;
+        uint64_t value_unsigned = 0;
+        int64_t value_integer = 0;
+    };
+
+    // Entries read while streaming, by enum index. Enums without streamed entries are read from the document.
+    struct streamed_entries {
+        std::vector<std::optional<std::vector<schema_entry>>> value_enums;
+        std::vector<std::optional<std::vector<schema_entry>>> flags_enums;
+    };
+
+    schema_entry read_schema_entry(json &entry) {
+        schema_entry se;
+        se.type = entry.type();
+        if (!entry.is_object()) {
+            return se;
+        }
+        auto name = entry.find("name");
+        if (name != entry.end()) {
+            se.name_type = name->type();
+            if (name->is_string()) {
+                se.name = std::move(name->get_ref<std::string &>());
+            }
+        }
+        auto description = entry.find("description");
+        if (description != entry.end()) {
+            se.has_description = true;
+            se.description_type = description->type();
+            if (description->is_string()) {
+                se.description = std::move(description->get_ref<std::string &>());
+            }
+        }
+        auto value = entry.find("value");
+        if (value != entry.end()) {
+            se.value_type = value->type();
+            if (value->is_string()) {
+                se.value_string = std::move(value->get_ref<std::string &>());
+            } else if (value->is_number_unsigned()) {
+                se.value_unsigned = value->get<uint64_t>();
+            } else if (value->is_number_integer()) {
+                se.value_integer = value->get<int64_t>();
+            }
+        }
+        return se;
+    }
+
+    // Iterates entries like a range-for over the document node: arrays by element, objects by value,
+    // a single value once and null not at all
+    std::vector<schema_entry> read_schema_entries(json &entries) {
+        std::vector<schema_entry> out;
+        out.reserve(entries.size());
+        for (auto &entry: entries) {
+            out.push_back(read_schema_entry(entry));
+        }
+        return out;
+    }
+
+    // Converts a string field of an entry, throws the type_error that get<std::string>() throws for the same JSON
+    std::string take_entry_string(json::value_t type, std::string &value) {
+        if (type == json::value_t::string) {
+            return std::move(value);
+        }
+        return json(type).get<std::string>();
+    }
+
+    std::string take_entry_name(schema_entry &se) {
+        if (se.type != json::value_t::object && se.type != json::value_t::null) {
+            // Throws the type_error of operator[] on a non-object element
+            json element(se.type);
+            static_cast<void>(element["name"]);
+        }
+        return take_entry_string(se.name_type, se.name);
+    }
+
+    std::string take_entry_description(schema_entry &se) {
+        return se.has_description ? take_entry_string(se.description_type, se.description) : std::string();
+    }
+
+    // SAX handler that builds the schema document like json::parse, except for the "entries" arrays of enums.
+    // Those are read straight into schema_entry lists, which avoids a document node per entry and field.
+    class schema_reader {
+    public:
+        json root;
+        streamed_entries entries;
+
+        bool null() { return value(json::value_t::null, nullptr); }
+        bool boolean(bool v) { return value(json::value_t::boolean, v); }
+        bool number_integer(json::number_integer_t v) {
+            // Other numeric keys of an entry are ignored, like read_schema_entry does
+            if (in_entry_field() && field_ == entry_field::value) {
+                current_entry().value_integer = v;
+            }
+            return value(json::value_t::number_integer, v);
+        }
+        bool number_unsigned(json::number_unsigned_t v) {
+            // Other numeric keys of an entry are ignored, like read_schema_entry does
+            if (in_entry_field() && field_ == entry_field::value) {
+                current_entry().value_unsigned = v;
+            }
+            return value(json::value_t::number_unsigned, v);
+        }
+        bool number_float(json::number_float_t v, const json::string_t &) { return value(json::value_t::number_float, v); }
+        bool string(json::string_t &v) {
+            if (in_entry_field()) {
+                auto &e = current_entry();
+                switch (field_) {
+                    case entry_field::name: e.name = std::move(v); break;
+                    case entry_field::description: e.description = std::move(v); break;
+                    case entry_field::value: e.value_string = std::move(v); break;
+                    case entry_field::other: break;
+                }
+            }
+            return value(json::value_t::string, std::move(v));
+        }
+        bool binary(json::binary_t &v) { return value(json::value_t::binary, json::binary(std::move(v))); }
+
+        bool start_object(std::size_t) {
+            if (in_entries()) {
+                return start_entries_container(json::value_t::object);
+            }
+            frame f{frame_kind::other, nullptr, 0};
+            const frame_kind parent = frames_.empty() ? frame_kind::none : frames_.back().kind;
+            if (parent == frame_kind::none) {
+                f.kind = frame_kind::root;
+            } else if (parent == frame_kind::root && key_ == "enums") {
+                f.kind = frame_kind::enums;
+            } else if (parent == frame_kind::value_list || parent == frame_kind::flags_list) {
+                f.kind = (parent == frame_kind::value_list) ? frame_kind::value_enum : frame_kind::flags_enum;
+                f.index = frames_.back().node->size();
+            }
+            f.node = &insert(json(json::value_t::object));
+            frames_.push_back(f);
+            return true;
+        }
+
+        bool start_array(std::size_t) {
+            if (in_entries()) {
+                return start_entries_container(json::value_t::array);
+            }
+            const frame_kind parent = frames_.empty() ? frame_kind::none : frames_.back().kind;
+            if ((parent == frame_kind::value_enum || parent == frame_kind::flags_enum) && key_ == "entries") {
+                auto &list = (parent == frame_kind::value_enum) ? entries.value_enums : entries.flags_enums;
+                const size_t index = frames_.back().index;
+                if (list.size() <= index) {
+                    list.resize(index + 1);
+                }
+                list[index].emplace();
+                entries_ = &*list[index];
+                entry_depth_ = 1;
+                return true;
+            }
+            frame f{frame_kind::other, nullptr, 0};
+            if (parent == frame_kind::enums && key_ == "value_enums") {
+                f.kind = frame_kind::value_list;
+            } else if (parent == frame_kind::enums && key_ == "flags_enums") {
+                f.kind = frame_kind::flags_list;
+            }
+            f.node = &insert(json(json::value_t::array));
+            frames_.push_back(f);
+            return true;
+        }
+
+        bool key(json::string_t &k) {
+            if (in_entries()) {
+                if (skip_depth_ == 0 && entry_depth_ == 2) {
+                    field_ = (k == "name") ? entry_field::name
+                           : (k == "description") ? entry_field::description
+                           : (k == "value") ? entry_field::value
+                           : entry_field::other;
+                }
+                return true;
+            }
+            // The last occurrence of a key wins, drop what an earlier occurrence left behind
+            const frame &f = frames_.back();
+            if ((f.kind == frame_kind::value_enum || f.kind == frame_kind::flags_enum) && k == "entries") {
+                auto &list = (f.kind == frame_kind::value_enum) ? entries.value_enums : entries.flags_enums;
+                if (f.index < list.size()) {
+                    list[f.index].reset();
+                }
+                f.node->erase("entries");
+            } else if (f.kind == frame_kind::enums && k == "value_enums") {
+                entries.value_enums.clear();
+            } else if (f.kind == frame_kind::enums && k == "flags_enums") {
+                entries.flags_enums.clear();
+            } else if (f.kind == frame_kind::root && k == "enums") {
+                entries = streamed_entries();
+            }
+            key_ = std::move(k);
+            return true;
+        }
+
+        bool end_object() {
+            if (in_entries()) {
+                if (skip_depth_ > 0) {
+                    skip_depth_--;
+                } else {
+                    entry_depth_ = 1;
+                }
+                return true;
+            }
+            frames_.pop_back();
+            return true;
+        }
+
+        bool end_array() {
+            if (in_entries()) {
+                if (skip_depth_ > 0) {
+                    skip_depth_--;
+                } else {
+                    entries_ = nullptr;
+                    entry_depth_ = 0;
+                }
+                return true;
+            }
+            frames_.pop_back();
+            return true;
+        }
+
+        template<class Exception>
+        bool parse_error(std::size_t, const std::string &, const Exception &ex) {
+            throw ex;
+        }
+
+    private:
+        enum class frame_kind { none, other, root, enums, value_list, flags_list, value_enum, flags_enum };
+        struct frame {
+            frame_kind kind;
+            json *node;
+            size_t index; // Of an enum in its list
+        };
+        enum class entry_field { name, description, value, other };
+
+        std::vector<frame> frames_;
+        std::string key_; // Last key of the innermost object
+
+        // Position in an "entries" array
+        std::vector<schema_entry> *entries_ = nullptr;
+        int entry_depth_ = 0; // 1 in the array, 2 in an entry object
+        int skip_depth_ = 0; // Depth of nested containers that are skipped
+        entry_field field_ = entry_field::other;
+
+        [[nodiscard]] bool in_entries() const { return entries_ != nullptr; }
+        // A scalar at this point is a field of the current entry
+        [[nodiscard]] bool in_entry_field() const { return in_entries() && skip_depth_ == 0 && entry_depth_ == 2; }
+        schema_entry &current_entry() { return entries_->back(); }
+
+        json &insert(json v) {
+            if (frames_.empty()) {
+                root = std::move(v);
+                return root;
+            }
+            json &parent = *frames_.back().node;
+            if (parent.is_array()) {
+                parent.push_back(std::move(v));
+                return parent.back();
+            }
+            json &slot = parent[key_];
+            slot = std::move(v);
+            return slot;
+        }
+
+        template<class T>
+        bool value(json::value_t type, T &&v) {
+            if (in_entries()) {
+                if (skip_depth_ == 0) {
+                    set_entry_type(type);
+                }
+                return true;
+            }
+            insert(json(std::forward<T>(v)));
+            return true;
+        }
+
+        // A scalar or a container started inside an "entries" array, only fields of entry objects are kept
+        void set_entry_type(json::value_t type) {
+            if (entry_depth_ == 1) {
+                entries_->emplace_back().type = type;
+                return;
+            }
+            auto &e = current_entry();
+            switch (field_) {
+                case entry_field::name: e.name_type = type; break;
+                case entry_field::description: e.has_description = true; e.description_type = type; break;
+                case entry_field::value: e.value_type = type; break;
+                case entry_field::other: break;
+            }
+        }
+
+        bool start_entries_container(json::value_t type) {
+            if (skip_depth_ > 0) {
+                skip_depth_++;
+                return true;
+            }
+            set_entry_type(type);
+            if (entry_depth_ == 1 && type == json::value_t::object) {
+                entry_depth_ = 2;
+                field_ = entry_field::other;
+            } else {
+                skip_depth_ = 1;
+            }
+            return true;
+        }
+    };
+}
+
+void load_enum_meta(const enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config,
+                    streamed_entries *streamed);
+
+using namespace enumbra;
+
+enumbra::enumbra_config load_enumbra_config(const std::string &config_file) {
+    const mapped_file file(config_file);
+    return parse_enumbra_config_text(file.contents());
+}
+
+enumbra::enumbra_config parse_enumbra_config_text(std::string_view text) {
+    const profile_scope scope("load_config");
+    return parse_enumbra_config(json::parse(text, nullptr, true, true));
+}
+
+enumbra::enumbra_config parse_enumbra_config(json data) {
+    enumbra::enumbra_config cfg;
+
+    auto &configuration = data["enumbra_config"];
+    auto &cpp_config = configuration["cpp_generator"];
+    auto &csharp_config = configuration["csharp_generator"];
+
+    if (cpp_config.is_object()) {
+        parse_enumbra_cpp(cfg, cpp_config);
+    }
+    if (csharp_config.is_object()) {
+        parse_enumbra_csharp(cfg, csharp_config);
+    }
+
+    return cfg;
+}
+
+enumbra::enum_meta_config load_meta_config(const enumbra::enumbra_config &enumbra_config, const std::string &config_file) {
+    const mapped_file file(config_file);
+    return parse_meta_config_text(enumbra_config, file.contents());
+}
+
+enumbra::enum_meta_config parse_meta_config_text(const enumbra::enumbra_config &enumbra_config, std::string_view text) {
+    const profile_scope scope("load_schema");
+    // Streamed, the entries of enums are read without building document nodes for them
+    schema_reader reader;
+    json::sax_parse(text.begin(), text.end(), &reader, json::input_format_t::json, true, true);
+
+    enumbra::enum_meta_config cfg;
+    load_enum_meta(enumbra_config, cfg, reader.root["enums"], &reader.entries);
+    return cfg;
+}
+
+enumbra::enum_meta_config parse_meta_config(const enumbra::enumbra_config &enumbra_config, json data) {
+    enumbra::enum_meta_config cfg;
+
+    auto &enum_meta = data["enums"];
+
+    parse_enum_meta(enumbra_config, cfg, enum_meta);
+
+    return cfg;
+}
+
+void parse_enumbra_cpp(enumbra::enumbra_config &enumbra_config, json &cpp_cfg) {
+    using namespace enumbra::cpp;
+    try {
+        cpp_config &c = enumbra_config.cpp_config;
+
+        c.output_namespace = get_array<std::string>(cpp_cfg["output_namespace"]);
+        c.time_generated_in_header = cpp_cfg["time_generated_in_header"].get<bool>();
+        c.preamble_text = get_array<std::string>(cpp_cfg["preamble_text"]);
+        c.additional_includes = get_array<std::string>(cpp_cfg["additional_includes"]);
+
+        for (auto iter: cpp_cfg["size_types"]) {
+            enum_size_type t;
+            t.name = iter["name"].get<std::string>();
+            t.bits = iter["bits"].get<int32_t>();
+            t.is_signed = iter["is_signed"].get<bool>();
+            t.type_name = iter["type_name"].get<std::string>();
+
+            if (t.name.empty()) {
+                throw std::logic_error("size type name cannot be empty");
+            }
+            if (t.bits > 64) {
+                throw std::logic_error("size type bits cannot be greater than 64");
+            }
+            if (t.type_name.empty()) {
+                throw std::logic_error("size type type_name cannot be empty");
+            }
+
+            if (t.is_signed) {
+                // To get the maximum, we fill all bits except the sign bit
+                t.max_possible_value = 0;
+                for (int32_t i = 0; i < t.bits - 1; i++) {
+                    t.max_possible_value |= (int128(1) << static_cast<int>(i));
+                }
+
+                // Minimum is found by inverting the max value, then subtract 1
+                t.min_possible_value = -t.max_possible_value - 1;
+            } else {
+                // To get the maximum, we fill all bits
+                t.max_possible_value = 0;
+                for (int32_t i = 0; i < t.bits; i++) {
+                    t.max_possible_value |= (int128(1) << static_cast<int>(i));
+                }
+
+                // Minimum always 0
+                t.min_possible_value = 0;
+            }
+
+            c.size_types.push_back(t);
+        }
+        if (c.size_types.empty()) {
+            throw std::logic_error("size_types array is required. See the enumbra documentation for details.");
+        }
+
+        std::string default_value_enum_size_type = cpp_cfg["default_value_enum_size_type"].get<std::string>();
+        c.default_value_enum_size_type_index = c.get_size_type_index_from_name(default_value_enum_size_type);
+        if (c.default_value_enum_size_type_index == SIZE_MAX) {
+            throw std::logic_error("default_value_enum_size_type must reference an existing size_type.");
+        }
+
+        std::string default_flags_enum_size_type = cpp_cfg["default_flags_enum_size_type"].get<std::string>();
+        c.default_flags_enum_size_type_index = c.get_size_type_index_from_name(default_flags_enum_size_type);
+        if (c.default_flags_enum_size_type_index == SIZE_MAX) {
+            throw std::logic_error("default_flags_enum_size_type must reference an existing size_type.");
+        }
+
+        c.string_table_layout = get_mapped<StringTableLayout>(StringTableLayoutMapped, cpp_cfg["string_table_layout"]);
+        if (cpp_cfg.contains("simd_codegen")) {
+            c.simd_codegen = get_mapped<SIMDCodeGen>(SIMDCodeGenMapped, cpp_cfg["simd_codegen"]);
+        }
+
+        c.min_max_functions = cpp_cfg["min_max_functions"].get<bool>();
+        c.bit_info_functions = cpp_cfg["bit_info_functions"].get<bool>();
+        c.enumbra_bitfield_macros = cpp_cfg["enumbra_bitfield_macros"].get<bool>();
+    }
+    catch (const std::exception &e) {
+
+        std::string x = std::string("parse_enumbra_cpp_config: ") + e.what();
+        throw std::logic_error(x.c_str());
+    }
+}
+
+void parse_enumbra_csharp(enumbra::enumbra_config & /*enumbra_config*/, json & /*csharp_cfg*/) {
+    throw std::logic_error("parse_enumbra_csharp not implemented.");
+}
+
+bool is_pow_2(int128 x) {
+    return x && !(x & (x - 1));
+}
+
+int128 string_to_int128(const std::string_view s) {
+    const bool bIsHexString = (s.size() >= 2) && (s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X'));
+    const bool bIsBinaryString = (s.size() >= 2) && (s[0] == '0') && ((s[1] == 'b'));
+    if (bIsHexString) {
+        // Unsigned Hex
+        uint64_t unsigned_value;
+        auto result = std::from_chars(s.data() + 2, s.data() + s.size(), unsigned_value, 16);
+        const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
+        if (bConsumedEntireString && result.ec == std::errc{}) {
+            return int128(unsigned_value);
+        }
+    } else if (bIsBinaryString) {
+        // Unsigned Binary
+        uint64_t unsigned_value;
+        auto result = std::from_chars(s.data() + 2, s.data() + s.size(), unsigned_value, 2);
+        const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
+        if (bConsumedEntireString && result.ec == std::errc{}) {
+            return int128(unsigned_value);
+        }
+    } else {
+        // Signed Base 10
+        {
+            int64_t signed_value;
+            auto result = std::from_chars(s.data(), s.data() + s.size(), signed_value);
+            const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
+            if (bConsumedEntireString && result.ec == std::errc{}) {
+                return int128(signed_value);
+            }
+        }
+
+        // Unsigned Base 10
+        {
+            uint64_t unsigned_value;
+            auto result = std::from_chars(s.data(), s.data() + s.size(), unsigned_value);
+            const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
+            if (bConsumedEntireString && result.ec == std::errc{}) {
+                return int128(unsigned_value);
+            }
+        }
+    }
+
+    throw std::invalid_argument(fmt::format("\"{0}\" could not be parsed to an integer.", s));
+}
+
+// Throws if v will not be storable in the defined size_type
+void validate_value_fits_in_size_type(const enumbra::cpp::enum_size_type &size_type, const int128 v) {
+    if ((v < size_type.min_possible_value) || (v > size_type.max_possible_value)) {
+        auto to_string_128 = [](int128 v) -> std::string {
+            return (v < 0) ? fmt::format("{0}", static_cast<int64_t>(v)) : fmt::format("{0}", static_cast<uint64_t>(v));
+        };
+        auto to_string_128_hex = [](int128 v) -> std::string {
+            return (v < 0) ? fmt::format("{0:#x}", static_cast<int64_t>(v)) : fmt::format("{0:#x}",
+                                                                                          static_cast<uint64_t>(v));
+        };
+        throw std::logic_error(fmt::format("entry_value {0} ({1}) is out of the possible range {2} to {3}",
+                                           to_string_128(v),
+                                           to_string_128_hex(v),
+                                           to_string_128(size_type.min_possible_value),
+                                           to_string_128(size_type.max_possible_value)
+        ));
+    }
+}
+
+void parse_flags_constraints(enumbra::flags_constraints &constraints, const json &constraints_cfg) {
+    if (constraints_cfg.is_null()) {
+        return;
+    }
+    if (!constraints_cfg.is_object()) {
+        throw std::logic_error("flags_enum constraints must be an object");
+    }
+
+    // Missing keys are looked up with find(), operator[] on a non-const json would insert nulls
+    auto parse_groups = [&constraints_cfg](std::vector<std::vector<std::string>> &out, const char *kind) {
+        const auto groups = constraints_cfg.find(kind);
+        if (groups == constraints_cfg.end()) {
+            return;
+        }
+        for (const auto &group: *groups) {
+            auto names = group.get<std::vector<std::string>>();
+            if (names.size() < 2) {
+                throw std::logic_error(fmt::format("flags_enum constraint {} group must contain at least 2 flags", kind));
+            }
+            out.push_back(std::move(names));
+        }
+    };
+    auto parse_relations = [&constraints_cfg](std::vector<flags_relation> &out, const char *kind) {
+        const auto relations = constraints_cfg.find(kind);
+        if (relations == constraints_cfg.end() || relations->is_null()) {
+            return;
+        }
+        if (!relations->is_object()) {
+            throw std::logic_error(fmt::format("flags_enum constraint {} must be an object of flag name to flag names", kind));
+        }
+        for (const auto &[flag, targets]: relations->items()) {
+            flags_relation r;
+            r.flag = flag;
+            r.targets = targets.is_string()
+                        ? std::vector<std::string>{targets.get<std::string>()}
+                        : targets.get<std::vector<std::string>>();
+            out.push_back(std::move(r));
+        }
+    };
+
+    parse_groups(constraints.exclusive, "exclusive");
+    parse_groups(constraints.exactly_one, "exactly_one");
+    parse_relations(constraints.requirements, "requires");
+    parse_relations(constraints.implications, "implies");
+}
+
+namespace {
+    // Value of an entry that has one
+    int128 get_entry_value(const schema_entry &se) {
+        switch (se.value_type) {
+            case json::value_t::string:
+                return string_to_int128(se.value_string);
+            case json::value_t::number_unsigned:
+                return se.value_unsigned;
+            case json::value_t::number_integer:
+                return se.value_integer;
+            default:
+                throw std::logic_error("entry_value type is not valid");
+        }
+    }
+
+    // Entries of the enum at index of a list, streamed or read from the document
+    std::vector<schema_entry> take_enum_entries(json &enum_cfg, std::vector<std::optional<std::vector<schema_entry>>> *streamed, size_t index) {
+        if (streamed && index < streamed->size() && (*streamed)[index]) {
+            return std::move(*(*streamed)[index]);
+        }
+        return read_schema_entries(enum_cfg["entries"]);
+    }
+
+}
+
+void load_enum_meta(const enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config,
+                    streamed_entries *streamed) {
+
+    enum_config.value_enum_default_value_style = get_mapped<ValueEnumDefaultValueStyle>(
+            ValueEnumDefaultValueStyleMapped, meta_config["value_enum_default_value_style"]);
+    enum_config.flags_enum_default_value_style = get_mapped<FlagsEnumDefaultValueStyle>(
+            FlagsEnumDefaultValueStyleMapped, meta_config["flags_enum_default_value_style"]);
+
+    size_t value_enum_index = 0;
+    for (auto &value_enum: meta_config["value_enums"]) {
+        enum_definition def;
+        def.name = take_string(value_enum["name"]);
+
+        std::string size_type_string = value_enum.value("size_type", "");
+        if (!size_type_string.empty()) {
+            def.size_type_index = enumbra_config.cpp_config.get_size_type_index_from_name(size_type_string);
+            if (def.size_type_index == SIZE_MAX) {
+                throw std::logic_error(
+                        "value_enum size_type does not exist in global types table: " + size_type_string);
+            }
+        } else {
+            // use the default size_type
+            def.size_type_index = enumbra_config.cpp_config.default_value_enum_size_type_index;
+        }
+
+        def.default_value_name = value_enum.value("default_value", "");
+        def.group = parse_enum_group(value_enum);
+        def.out_of_line = value_enum.value("out_of_line", false);
+
+        int128 current_value = 0;
+        std::vector<schema_entry> entries = take_enum_entries(value_enum, streamed ? &streamed->value_enums : nullptr, value_enum_index++);
+        def.values.reserve(entries.size());
+        for (auto &entry: entries) {
+            enum_entry ee;
+            ee.name = take_entry_name(entry);
+            ee.description = take_entry_description(entry);
+
+            if(ee.name.empty()) {
+                throw std::logic_error("enum value name is empty");
+            }
+            if(contains_whitespace((ee.name))) {
+                throw std::logic_error("enum value name contains whitespace character");
+            }
+
+            if (entry.value_type == json::value_t::null) {
+                ee.p_value = current_value;
+            } else {
+                ee.p_value = get_entry_value(entry);
+            }
+
+            auto size_type = enumbra_config.cpp_config.get_size_type_from_index(def.size_type_index);
+            validate_value_fits_in_size_type(size_type, ee.p_value);
+
+            current_value = ee.p_value + 1;
+            def.values.push_back(std::move(ee));
+        }
+
+        std::sort(def.values.begin(), def.values.end(),
+                  [](const enum_entry &a, const enum_entry &b) { return a.p_value < b.p_value; }
+        );
+
+        enum_config.value_enum_definitions.push_back(std::move(def));
+    }
+
+
+    size_t flags_enum_index = 0;
+    for (auto &flags_enum: meta_config["flags_enums"]) {
+        enum_definition def;
+        def.name = take_string(flags_enum["name"]);
+        std::string size_type_string = flags_enum.value("size_type", "");
+        if (!size_type_string.empty()) {
+            def.size_type_index = enumbra_config.cpp_config.get_size_type_index_from_name(size_type_string);
+            if (def.size_type_index == SIZE_MAX) {
+                throw std::logic_error(
+                        "flags_enum size_type does not exist in global types table: " + size_type_string);
+            }
+        } else {
+            // use the default size_type
+            def.size_type_index = enumbra_config.cpp_config.default_flags_enum_size_type_index;
+        }
+        def.default_value_name = flags_enum.value("default_value", "");
+        def.group = parse_enum_group(flags_enum);
+        if (const auto constraints = flags_enum.find("constraints"); constraints != flags_enum.end()) {
+            parse_flags_constraints(def.constraints, *constraints);
+        }
+
+        for (auto &preset: flags_enum["presets"]) {
+            flags_preset p;
+            p.name = preset["name"].get<std::string>();
+            p.flags = preset["flags"].get<std::vector<std::string>>();
+            if (p.name.empty()) {
+                throw std::logic_error("flags_enum preset name is empty");
+            }
+            if (contains_whitespace(p.name)) {
+                throw std::logic_error("flags_enum preset name contains whitespace character");
+            }
+            if (p.flags.empty()) {
+                throw std::logic_error("flags_enum preset does not contain any flags: " + p.name);
+            }
+            def.presets.push_back(std::move(p));
+        }
+        def.to_string_presets = flags_enum.value("to_string_presets", false);
+
+        int64_t current_shift = 0;
+        std::vector<schema_entry> entries = take_enum_entries(flags_enum, streamed ? &streamed->flags_enums : nullptr, flags_enum_index++);
+        def.values.reserve(entries.size());
+        for (auto &entry: entries) {
+            enum_entry ee;
+            ee.name = take_entry_name(entry);
+            ee.description = take_entry_description(entry);
+
+            if (entry.value_type == json::value_t::null) {
+                ee.p_value = 1LL << current_shift;
+            } else {
+                ee.p_value = get_entry_value(entry);
+            }
+
+            auto &size_type = enumbra_config.cpp_config.get_size_type_from_index(def.size_type_index);
+            validate_value_fits_in_size_type(size_type, ee.p_value);
+
+            if (!is_pow_2(ee.p_value)) {
+                throw std::logic_error(
+                        "flags_enum value is not a power of 2 (1 bit set). Non-pow2 values are not currently supported.");
+            }
+            current_shift++;
+            while ((1LL << current_shift) < ee.p_value) {
+                current_shift++;
+            }
+            def.values.push_back(std::move(ee));
+        }
+
+        std::sort(def.values.begin(), def.values.end(),
+                  [](const enum_entry &a, const enum_entry &b) { return a.p_value < b.p_value; }
+        );
+
+        enum_config.flag_enum_definitions.push_back(std::move(def));
+    }
+}
+
+void
+parse_enum_meta(const enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config) {
+    load_enum_meta(enumbra_config, enum_config, meta_config, nullptr);
+}
+
+size_t enumbra::cpp::cpp_config::get_size_type_index_from_name(std::string_view name) const {
+    for (size_t i = 0; i < size_types.size(); i++) {
+        if (size_types[i].name == name) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+const enumbra::cpp::enum_size_type &enumbra::cpp::cpp_config::get_size_type_from_index(size_t index) const {
+    // Will throw if index out of bounds
+    return size_types.at(index);
+}
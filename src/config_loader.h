@@ -0,0 +1,26 @@
+#pragma once
+
+#include "enumbra.h"
+
+#include <string>
+#include <string_view>
+
+// Loads and validates enumbra_config.json, throws std::logic_error on invalid configs
+enumbra::enumbra_config load_enumbra_config(const std::string &config_file);
+
+// Loads and validates an enum schema (enum.json) against a loaded config, throws std::logic_error on invalid schemas
+enumbra::enum_meta_config load_meta_config(const enumbra::enumbra_config &enumbra_config, const std::string &config_file);
+
+// Same as the load functions for an already parsed document or JSON text in memory
+enumbra::enumbra_config parse_enumbra_config(json data);
+enumbra::enumbra_config parse_enumbra_config_text(std::string_view text);
+enumbra::enum_meta_config parse_meta_config(const enumbra::enumbra_config &enumbra_config, json data);
+enumbra::enum_meta_config parse_meta_config_text(const enumbra::enumbra_config &enumbra_config, std::string_view text);
+
+void parse_enumbra_cpp(enumbra::enumbra_config &enumbra_config, json &cpp_cfg);
+
+void parse_enumbra_csharp(enumbra::enumbra_config &enumbra_config, json &csharp_cfg);
+
+void parse_enum_meta(const enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config);
+
+void parse_flags_constraints(enumbra::flags_constraints &constraints, const json &constraints_cfg);
@@ -1,4 +1,7 @@
 #include "cpp_generator.h"
+#include "profiler.h"
+#include <algorithm>
+#include <bitset>
 #include <set>
 #include <vector>
 #include <map>
@@ -6,6 +9,11 @@
 using namespace enumbra;
 using namespace enumbra::cpp;
 
+// Increment these if the required macros or the base templates are modified.
+// Headers that include a shared base header check them against the base.
+constexpr int enumbra_required_macros_version = 9;
+constexpr int enumbra_templates_version = 35;
+
 uint64_t get_flags_enum_value(const FlagsEnumDefaultValueStyle &style, const enum_definition &definition) {
     switch (style) {
         case FlagsEnumDefaultValueStyle::Zero:
@@ -52,7 +60,7 @@ uint64_t get_flags_enum_value(const FlagsEnumDefaultValueStyle &style, const enu
     }
 }
 
-enum_entry get_value_enum_entry(const ValueEnumDefaultValueStyle &style, const enum_definition &definition) {
+const enum_entry &get_value_enum_entry(const ValueEnumDefaultValueStyle &style, const enum_definition &definition) {
     switch (style) {
         case ValueEnumDefaultValueStyle::Min: {
             auto m =
@@ -89,65 +97,190 @@ enum_entry get_value_enum_entry(const ValueEnumDefaultValueStyle &style, const e
     }
 }
 
+// Returns the index of the first name that repeats an earlier one, or count if all names are unique.
+// Open addressing over indices: linear time and a single allocation, even for enums with millions of entries.
+template<class GetName>
+size_t find_first_duplicate_name(size_t count, GetName &&get_name) {
+    size_t capacity = 16;
+    while (capacity < count * 2) {
+        capacity <<= 1;
+    }
+    constexpr uint32_t empty_slot = UINT32_MAX;
+    std::vector<uint32_t> slots(capacity, empty_slot);
+    for (size_t i = 0; i < count; i++) {
+        const std::string_view name = get_name(i);
+        size_t slot = fnv1a_64(name) & (capacity - 1);
+        while (slots[slot] != empty_slot) {
+            if (get_name(slots[slot]) == name) {
+                return i;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+        slots[slot] = static_cast<uint32_t>(i);
+    }
+    return count;
+}
+
 // Enum names must be unique across value and flag enums
 bool enum_meta_has_unique_enum_names(const enumbra::enum_meta_config &enum_meta) {
-    std::set<std::string> seen_names;
-    for (auto &v: enum_meta.value_enum_definitions) {
-        auto seen = seen_names.find(v.name);
-        if (seen != seen_names.end()) {
-            throw std::logic_error("enum_meta_has_unique_enum_names: Value-Enum name is not unique (name = " + *seen +
-                                   ")");
+    const size_t value_count = enum_meta.value_enum_definitions.size();
+    const size_t total_count = value_count + enum_meta.flag_enum_definitions.size();
+    const auto name_at = [&](size_t i) -> std::string_view {
+        return (i < value_count) ? enum_meta.value_enum_definitions[i].name : enum_meta.flag_enum_definitions[i - value_count].name;
+    };
+    const size_t duplicate = find_first_duplicate_name(total_count, name_at);
+    if (duplicate != total_count) {
+        throw std::logic_error(fmt::format("enum_meta_has_unique_enum_names: {}-Enum name is not unique (name = {})",
+                                           (duplicate < value_count) ? "Value" : "Flags", name_at(duplicate)));
+    }
+    return true;
+}
+
+// The loader sorts values, so this is a linear pass; unsorted values are sorted into a copy first.
+enum_validation validate_enum_definition(const enum_definition &e, bool is_flags, int64_t size_type_bits) {
+    enum_validation result;
+    const size_t count = e.values.size();
+
+    // 1. Names of contained values must be unique
+    const size_t duplicate = find_first_duplicate_name(count, [&](size_t i) -> std::string_view { return e.values[i].name; });
+    if (duplicate != count) {
+        if (is_flags) {
+            throw std::logic_error(
+                fmt::format("Enum Value Name is not unique (Enum = {}, Name = {})", e.name, e.values[duplicate].name));
         }
-        seen_names.insert(v.name);
+        throw std::runtime_error("Enum Value Name is not unique (name = " + e.values[duplicate].name + ")");
     }
-    for (auto &v: enum_meta.flag_enum_definitions) {
-        auto seen = seen_names.find(v.name);
-        if (seen != seen_names.end()) {
-            throw std::logic_error("enum_meta_has_unique_enum_names: Flags-Enum name is not unique (name = " + *seen +
-                                   ")");
+
+    // 2. Enum must have at least 1 value
+    if (count == 0) {
+        if (is_flags) {
+            throw std::logic_error(fmt::format("Enum does not contain any values (Enum = {})", e.name));
         }
-        seen_names.insert(v.name);
+        throw std::runtime_error(fmt::format("Enum does not contain any values (name = {})", e.name));
     }
-    return true;
-}
 
-bool is_value_set_contiguous(const std::set<int128> values) {
-    int128 value = *values.begin();
-    bool skip_first = true;
-    for (auto &u: values) {
-        if (skip_first) {
-            skip_first = false;
-            continue;
+    // 3. Enum values must be unique
+    // TODO: Properly define rules for value aliases
+    std::vector<int128> sorted_copy;
+    const bool is_sorted = std::is_sorted(e.values.begin(), e.values.end(),
+                                          [](const enum_entry &a, const enum_entry &b) { return a.p_value < b.p_value; });
+    if (!is_sorted) {
+        sorted_copy.reserve(count);
+        for (auto &v: e.values) {
+            sorted_copy.push_back(v.p_value);
+        }
+        std::sort(sorted_copy.begin(), sorted_copy.end());
+    }
+    const auto value_at = [&](size_t i) { return is_sorted ? e.values[i].p_value : sorted_copy[i]; };
+
+    for (size_t i = 1; i < count; i++) {
+        if (value_at(i) == value_at(i - 1)) {
+            if (is_flags) {
+                throw std::logic_error(fmt::format("Values in enum do not have unique values (Enum = {})", e.name));
+            }
+            throw std::runtime_error(fmt::format("Enum contains duplicate values (name = {})", e.name));
         }
-        if (u != (value + 1)) {
-            return false;
+    }
+    result.unique_entry_count = static_cast<int64_t>(count);
+
+    // Determine if range is contiguous
+    // Enables some minor optimizations for range-checking values if true
+    result.is_contiguous = true;
+    if (is_flags) {
+        // Each flag must be the next bit after the previous one. The expected bit is computed as a signed 64-bit value,
+        // so a flag at bit 63 never counts as contiguous.
+        int64_t check_bit = get_storage_bits_required(value_at(0));
+        for (size_t i = 1; i < count && result.is_contiguous; i++, check_bit++) {
+            result.is_contiguous = (check_bit < 64) && (value_at(i) == int128(static_cast<int64_t>(uint64_t{1} << check_bit)));
         }
-        value++;
+    } else {
+        result.is_contiguous = (value_at(count - 1) - value_at(0)) == int128(count - 1);
     }
-    return true;
+
+    // Sentinel candidates
+    const auto contains = [&](int128 value) {
+        size_t lo = 0;
+        size_t hi = count;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (value_at(mid) < value) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo < count && value_at(lo) == value;
+    };
+    int128 all_bits_mask = 0;
+    for (int64_t i = 0; i < size_type_bits; i++) {
+        all_bits_mask |= (1ULL << i);
+    }
+    result.has_zero = contains(0);
+    result.has_minus_one = contains(-1);
+    result.has_all_bits = contains(all_bits_mask);
+
+    return result;
 }
 
-bool is_flags_set_contiguous(const std::set<int128> flags) {
-    int64_t check_bit = get_storage_bits_required(*flags.begin());
-    bool skip_first = true;
-    for (auto &u: flags) {
-        if (skip_first) {
-            skip_first = false;
-            continue;
+// Resolve flag names to a combined bit mask, throws if a name is not an entry of the enum
+uint64_t get_flags_mask(const enum_definition &e, const std::vector<std::string> &names) {
+    uint64_t mask = 0;
+    for (auto &name: names) {
+        auto found = std::find_if(e.values.begin(), e.values.end(),
+                                  [&name](const enum_entry &entry) { return entry.name == name; });
+        if (found == e.values.end()) {
+            throw std::logic_error(
+                fmt::format("Flags-Enum constraint references an unknown flag (Enum = {}, Name = {})", e.name, name));
         }
-        if (u != (1LL << check_bit)) {
-            return false;
+        mask |= static_cast<uint64_t>(found->p_value);
+    }
+    return mask;
+}
+
+// Transitive closure of the implications for each bit, excluding the bit itself
+std::array<uint64_t, 64> get_flags_implied_masks(const enum_definition &e) {
+    std::array<uint64_t, 64> implied{};
+    for (auto &relation: e.constraints.implications) {
+        const uint64_t flag = get_flags_mask(e, {relation.flag});
+        implied[log_2_unsigned(flag)] |= get_flags_mask(e, relation.targets);
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t bit = 0; bit < implied.size(); bit++) {
+            uint64_t expanded = implied[bit];
+            for (size_t other = 0; other < implied.size(); other++) {
+                if (implied[bit] & (1ULL << other)) {
+                    expanded |= implied[other];
+                }
+            }
+            expanded &= ~(1ULL << bit);
+            if (expanded != implied[bit]) {
+                implied[bit] = expanded;
+                changed = true;
+            }
         }
-        check_bit++;
     }
-    return true;
+    return implied;
 }
 
-cpp_generator::cpp_generator(const enumbra_config &cfg, const enum_meta_config &enum_meta)
-    : cpp_cfg(cfg.cpp_config), enum_meta(enum_meta) {}
+cpp_generator::cpp_generator(const enumbra_config &cfg, const enum_meta_config &enum_meta, unsigned int jobs)
+    : cpp_cfg(cfg.cpp_config), enum_meta(enum_meta), jobs(jobs) {}
+
+void cpp_generator::set_fragment_cache(fragment_cache *cache, std::string_view fingerprint) {
+    fragments_cache = cache;
+    config_fingerprint = fingerprint;
+}
+
+cpp_generator::cpp_generator(const cpp_config &cpp_cfg, const enum_meta_config &enum_meta, const std::string &enum_ns)
+    : cpp_cfg(cpp_cfg), enum_meta(enum_meta) {
+    ctx.enum_ns = enum_ns;
+}
 
 
 void cpp_generator::build_contexts() {
+    const profile_scope scope("build_contexts");
     ctx = output_context();
 
     // Construct the full namespace for templates
@@ -160,434 +293,884 @@ void cpp_generator::build_contexts() {
 }
 
 const std::string &cpp_generator::generate_cpp_output() {
+    emit_cpp_output();
+    return output;
+}
+
+void cpp_generator::generate_cpp_output(output_sink &out) {
+    sink = &out;
+    flushed_size = 0;
+    flushed_hash = fnv1a_64_basis;
+    output.clear();
+    emit_cpp_output();
+    flush_output(true);
+    sink = nullptr;
+}
+
+void cpp_generator::emit_cpp_output() {
 
     build_contexts();
 
-    // Precondition checks
-    // 1. Enum names must be unique
-    enum_meta_has_unique_enum_names(enum_meta);
+    validate_enums();
 
     emit_preamble();
 
     emit_include_guard_begin();
 
-    emit_includes();
+    if (shared_base.empty()) {
+        emit_includes();
 
-    emit_required_macros();
+        emit_required_macros();
 
-    emit_optional_macros();
+        emit_optional_macros();
 
-    emit_templates();
+        emit_templates();
 
-    // Flags Enums Precondition Checks
-    for (auto &e: enum_meta.flag_enum_definitions) {
-        // 1. Names of contained values must be unique
-        std::set<std::string> seen_names;
-        for (auto &v: e.values) {
-            auto res = seen_names.insert(v.name);
-            if (!res.second) {
-                throw std::logic_error(
-                    fmt::format("Enum Value Name is not unique (Enum = {}, Name = {})", e.name, v.name));
+        emit_simd_templates();
+    } else {
+        emit_base_include(shared_base);
+    }
+
+    flush_output(false);
+
+    // Streamed output only holds a window of enums in memory, otherwise all enums are emitted at once
+    constexpr size_t streamed_enum_window = 256;
+    const size_t value_enum_count = enum_meta.value_enum_definitions.size();
+    const size_t enum_count = value_enum_count + enum_meta.flag_enum_definitions.size();
+    const size_t window = sink ? streamed_enum_window : std::max<size_t>(enum_count, 1);
+    for (size_t begin = 0; begin < enum_count; begin += window) {
+        const size_t end = std::min(enum_count, begin + window);
+        const std::vector<std::string> fragments = emit_enum_fragments(begin, end);
+
+        if (!sink) {
+            size_t fragments_size = 0;
+            for (const auto &f: fragments) {
+                fragments_size += f.size();
             }
+            output.reserve(output.size() + fragments_size + 64);
         }
-        seen_names.clear();
 
-        // 2. Enum must have at least 1 value
-        if (e.values.empty()) {
-            throw std::logic_error(fmt::format("Enum does not contain any values (Enum = {})", e.name));
+        for (size_t i = begin; i < end; i++) {
+            // Blank line between the value enum and flags enum definitions
+            if (i == value_enum_count) {
+                wlf();
+            }
+            output += fragments[i - begin];
+            flush_output(false);
         }
+    }
+    if (value_enum_count == enum_count) {
+        wlf();
+    }
 
-        // 3. Determine if all values are unique, or if some enum value names overlap.
-        // TODO: Properly define rules for value aliases
-        std::set<int128> unique_values;
-        for (auto &v: e.values) {
-            unique_values.insert(v.p_value);
+    emit_include_guard_end();
+
+    finalize_include_guard();
+}
+
+void cpp_generator::flush_output(bool force) {
+    constexpr size_t flush_threshold = 256 * 1024;
+    if (!sink || (!force && output.size() < flush_threshold)) {
+        return;
+    }
+    {
+        const profile_scope scope("hash_output");
+        flushed_hash = fnv1a_64_update(flushed_hash, output);
+    }
+    const profile_scope scope("write_output");
+    sink->write(output);
+    flushed_size += output.size();
+    output.clear();
+}
+
+std::vector<generated_file> cpp_generator::generate_cpp_shards(const cpp_shard_options &options) {
+
+    build_contexts();
+
+    validate_enums();
+
+    const size_t value_enum_count = enum_meta.value_enum_definitions.size();
+    const std::vector<std::string> fragments = emit_enum_fragments(0, value_enum_count + enum_meta.flag_enum_definitions.size());
+
+    std::vector<generated_file> files;
+    files.push_back(emit_base_file(options.base_name));
+
+    // One shard per group, or per enum if it has no group, in order of first appearance in the schema
+    std::vector<std::string> shard_names;
+    std::vector<std::vector<size_t>> shard_fragments;
+    std::vector<bool> shard_is_group;
+    std::map<std::string, size_t> shard_index;
+    for (size_t i = 0; i < fragments.size(); i++) {
+        const auto &definition = (i < value_enum_count)
+                                 ? enum_meta.value_enum_definitions[i]
+                                 : enum_meta.flag_enum_definitions[i - value_enum_count];
+        const bool is_group = !definition.group.empty();
+        const std::string &name = is_group ? definition.group : definition.name;
+        auto inserted = shard_index.emplace(name, shard_names.size());
+        if (inserted.second) {
+            shard_names.push_back(name);
+            shard_fragments.emplace_back();
+            shard_is_group.push_back(is_group);
+        } else if (!is_group || !shard_is_group[inserted.first->second]) {
+            throw std::logic_error(fmt::format("Enum name is also used as a group name, the shard headers would collide (name = {})", name));
         }
-        if (e.values.size() != unique_values.size()) {
-            throw std::logic_error(
-                fmt::format("Values in enum do not have unique values (Enum = {})", e.name));
+        shard_fragments[inserted.first->second].push_back(i);
+    }
+    for (size_t s = 0; s < shard_names.size(); s++) {
+        cpp_generator shard(cpp_cfg, enum_meta, ctx.enum_ns);
+        shard.emit_preamble();
+        shard.emit_include_guard_begin();
+        shard.emit_base_include(options.base_name);
+        for (const size_t i: shard_fragments[s]) {
+            shard.output += fragments[i];
         }
+        files.push_back(finish_file(shard, shard_names[s] + options.extension));
     }
 
-    // Build value enum contexts
-    for (auto &e: enum_meta.value_enum_definitions) {
-        clear_store();
+    // Umbrella header including every shard
+    if (!options.umbrella_name.empty()) {
+        cpp_generator umbrella(cpp_cfg, enum_meta, ctx.enum_ns);
+        umbrella.emit_preamble();
+        umbrella.emit_include_guard_begin();
+        for (size_t f = 1; f < files.size(); f++) {
+            umbrella.wl("#include \"{}\"", files[f].name);
+        }
+        umbrella.wlf();
+        files.push_back(finish_file(umbrella, options.umbrella_name));
+    }
 
-        // Value Enum Precondition checks
+    return files;
+}
 
-        // 1. Names of contained values must be unique
-        std::set<std::string> seen_names;
-        for (auto &v: e.values) {
-            auto seen = seen_names.find(v.name);
-            if (seen != seen_names.end()) {
-                throw std::runtime_error("Enum Value Name is not unique (name = " + *seen + ")");
+generated_file cpp_generator::generate_cpp_base(const std::string &name) {
+    build_contexts();
+    return emit_base_file(name);
+}
+
+generated_file cpp_generator::emit_base_file(std::string name) const {
+    // Everything that isn't specific to an enum
+    cpp_generator base(cpp_cfg, enum_meta, ctx.enum_ns);
+    base.emit_preamble();
+    base.emit_include_guard_begin();
+    base.emit_includes();
+    base.emit_required_macros();
+    base.emit_optional_macros();
+    base.emit_templates();
+    base.emit_simd_templates();
+    return finish_file(base, std::move(name));
+}
+
+generated_file cpp_generator::finish_file(cpp_generator &file_gen, std::string name) {
+    file_gen.emit_include_guard_end();
+    file_gen.finalize_include_guard();
+    return generated_file{std::move(name), std::move(file_gen.output), file_gen.get_include_guard(), file_gen.get_include_guard_position()};
+}
+
+void cpp_generator::emit_base_include(const std::string &name) {
+    // The base checks its blocks against headers of other versions included before it, this checks the base itself
+    wl("#include \"{}\"", name);
+    wl("#if (ENUMBRA_REQUIRED_MACROS_VERSION + 0) != {0} || (ENUMBRA_BASE_TEMPLATES_VERSION + 0) != {1}", enumbra_required_macros_version, enumbra_templates_version);
+    wl("#error {} was generated using another version of enumbra. Regenerate your headers using the same version.", name);
+    wlu("#endif");
+    wlf();
+}
+
+std::vector<generated_file> cpp_generator::generate_cpp_module(const cpp_module_options &options) {
+    if (!is_valid_module_name(options.module_name)) {
+        throw std::logic_error(fmt::format("Module name is not a valid C++ module name (name = {})", options.module_name));
+    }
+
+    build_contexts();
+
+    validate_enums();
+
+    module_unit = true;
+    const size_t enum_count = enum_meta.value_enum_definitions.size() + enum_meta.flag_enum_definitions.size();
+    const std::vector<std::string> fragments = emit_enum_fragments(0, enum_count);
+
+    std::vector<generated_file> files;
+
+    // The base templates are a partition so the enums can be split into several modules later without changing users
+    {
+        cpp_generator base(cpp_cfg, enum_meta, ctx.enum_ns);
+        base.module_unit = true;
+        base.emit_preamble();
+        base.emit_module_fragment();
+        base.wl("export module {}:base;", options.module_name);
+        base.emit_templates();
+        base.emit_simd_templates();
+        files.push_back({options.module_name + "-base" + options.extension, std::move(base.output), {}, 0});
+    }
+
+    cpp_generator primary(cpp_cfg, enum_meta, ctx.enum_ns);
+    primary.module_unit = true;
+    primary.emit_preamble();
+    primary.emit_module_fragment();
+    primary.wl("export module {};", options.module_name);
+    primary.wlu("export import :base;");
+    primary.wlf();
+    for (const auto &f: fragments) {
+        primary.output += f;
+    }
+    files.push_back({options.module_name + options.extension, std::move(primary.output), {}, 0});
+
+    return files;
+}
+
+generated_file cpp_generator::generate_cpp_source(std::string name, const std::string &header_include) {
+    const profile_scope scope("generate_cpp_source");
+
+    build_contexts();
+
+    validate_enums();
+
+    cpp_generator source(cpp_cfg, enum_meta, ctx.enum_ns);
+    source.emit_preamble();
+    source.wl("#include \"{}\"", header_include);
+    source.wlf();
+
+    // Definitions of the out-of-line value enums, in schema order
+    std::vector<std::string> fragments(enum_meta.value_enum_definitions.size());
+    run_parallel(fragments.size(), jobs, [&](size_t i) {
+        const auto &definition = enum_meta.value_enum_definitions[i];
+        if (!definition.out_of_line) {
+            return;
+        }
+        cpp_generator worker(cpp_cfg, enum_meta, ctx.enum_ns);
+        worker.out_of_line = true;
+        worker.source_unit = true;
+        const value_enum_context context = worker.build_value_enum_context(definition, ctx.validation.value_enums[i]);
+        if (context.out_of_line) {
+            worker.emit_value_enum_source(context);
+            fragments[i] = std::move(worker.output);
+        }
+    });
+    for (const auto &f: fragments) {
+        source.output += f;
+    }
+
+    return generated_file{std::move(name), std::move(source.output), {}, 0};
+}
+
+void cpp_generator::emit_module_fragment() {
+    // Everything that is included or only defines macros goes into the global module fragment. The intrinsics are
+    // included here so the include in the SIMD templates finds them already included instead of attaching them to the module.
+    wlu("module;");
+    emit_includes();
+    emit_required_macros();
+    if (cpp_cfg.simd_codegen != SIMDCodeGen::Scalar64 && cpp_cfg.simd_codegen != SIMDCodeGen::Scalar32) {
+        wlu("#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))");
+        wlu("#define ENUMBRA_SIMD_SSE2");
+        wlu("#if defined(__AVX2__)");
+        wlu("#define ENUMBRA_SIMD_AVX2");
+        wlu("#include <immintrin.h>");
+        wlu("#else");
+        wlu("#include <emmintrin.h>");
+        wlu("#endif");
+        wlu("#endif");
+    }
+    wlf();
+}
+
+schema_validation validate_schema(const cpp_config &cpp_cfg, const enum_meta_config &enum_meta, unsigned int jobs) {
+    const profile_scope scope("validate");
+
+    // Precondition checks
+    // 1. Enum names must be unique
+    enum_meta_has_unique_enum_names(enum_meta);
+
+    // 2. Per enum checks, flags enums first. Errors are reported for the first failing enum in that order.
+    schema_validation validation;
+    const size_t flags_enum_count = enum_meta.flag_enum_definitions.size();
+    const size_t value_enum_count = enum_meta.value_enum_definitions.size();
+    validation.flags_enums.resize(flags_enum_count);
+    validation.value_enums.resize(value_enum_count);
+    run_parallel(flags_enum_count + value_enum_count, jobs, [&](size_t i) {
+        const bool is_flags = i < flags_enum_count;
+        const auto &e = is_flags ? enum_meta.flag_enum_definitions[i] : enum_meta.value_enum_definitions[i - flags_enum_count];
+        const int64_t size_type_bits = cpp_cfg.get_size_type_from_index(e.size_type_index).bits;
+        auto &result = is_flags ? validation.flags_enums[i] : validation.value_enums[i - flags_enum_count];
+        result = validate_enum_definition(e, is_flags, size_type_bits);
+    });
+    return validation;
+}
+
+void cpp_generator::validate_enums() {
+    if (precomputed_validation) {
+        ctx.validation = *precomputed_validation;
+        return;
+    }
+    ctx.validation = validate_schema(cpp_cfg, enum_meta, jobs);
+}
+
+std::vector<std::string> cpp_generator::emit_enum_fragments(size_t begin, size_t end) {
+    // Each enum is built and emitted into its own buffer with its own argument store, value enums first.
+    // Callers concatenate the buffers in schema order so the output does not depend on the number of jobs.
+    const size_t value_enum_count = enum_meta.value_enum_definitions.size();
+    std::vector<std::string> fragments(end - begin);
+
+    // Fragments depend on the definition, the config and the schema-wide default value styles
+    fnv1a_64_hash cache_seed = 0;
+    if (fragments_cache) {
+        cache_seed = fnv1a_64_append(fnv1a_64(kEnumbraVersion), config_fingerprint);
+        cache_seed = fnv1a_64_append(cache_seed, std::to_string(static_cast<int>(enum_meta.value_enum_default_value_style)));
+        cache_seed = fnv1a_64_append(cache_seed, std::to_string(static_cast<int>(enum_meta.flags_enum_default_value_style)));
+        if (module_unit) {
+            cache_seed = fnv1a_64_append(cache_seed, "module");
+        }
+        if (out_of_line) {
+            cache_seed = fnv1a_64_append(cache_seed, "out_of_line");
+        }
+    }
+
+    run_parallel(fragments.size(), jobs, [&](size_t fragment) {
+        const size_t i = begin + fragment;
+        const auto &definition = (i < value_enum_count)
+                                 ? enum_meta.value_enum_definitions[i]
+                                 : enum_meta.flag_enum_definitions[i - value_enum_count];
+        const profile_scope scope("enum", definition.name);
+        fnv1a_64_hash cache_key = 0;
+        if (fragments_cache) {
+            cache_key = hash_enum_definition(fnv1a_64_append(cache_seed, (i < value_enum_count) ? "value" : "flags"), definition);
+            if (auto cached = fragments_cache->find(cache_key)) {
+                fragments[fragment] = std::move(*cached);
+                return;
             }
-            seen_names.insert(v.name);
         }
-        seen_names.clear();
 
-        // 2. Enum must have at least 1 value
-        if (e.values.empty()) {
-            throw std::runtime_error(fmt::format("Enum does not contain any values (name = {})", e.name));
+        cpp_generator worker(cpp_cfg, enum_meta, ctx.enum_ns);
+        worker.module_unit = module_unit;
+        worker.out_of_line = out_of_line;
+        worker.output.reserve(4096 + definition.values.size() * 256);
+        if (i < value_enum_count) {
+            const value_enum_context context = worker.build_value_enum_context(definition, ctx.validation.value_enums[i]);
+            worker.emit_value_enum(context);
+        } else {
+            worker.emit_flags_enum(definition, ctx.validation.flags_enums[i - value_enum_count]);
         }
+        fragments[fragment] = std::move(worker.output);
+        if (fragments_cache) {
+            fragments_cache->insert(cache_key, fragments[fragment]);
+        }
+    });
 
-        // 3. Enum values must be unique
-        std::set<int128> unique_values;
-        for (auto &v: e.values) { unique_values.insert(v.p_value); }
-        if (unique_values.size() != e.values.size()) {
-            throw std::runtime_error(fmt::format("Enum contains duplicate values (name = {})", e.name));
+    return fragments;
+}
+
+void cpp_generator::finalize_include_guard() {
+    const profile_scope scope("hash_output");
+    // Hash the whole file to generate a unique include guard
+    const fnv1a_64_hash hash = fnv1a_64_update(flushed_hash, output);
+    std::string hash_str = fmt::format("ENUMBRA_{0:X}_H", hash);
+    for (const size_t location : ctx.header_guard_positions) {
+        if (location < flushed_size) {
+            sink->patch(location, hash_str);
+        } else {
+            output.replace(location - flushed_size, hash_str.size(), hash_str);
         }
+    }
+    ctx.include_guard = std::move(hash_str);
+}
 
-        // Build Context
-        value_enum_context new_context;
-
-        new_context.enum_name = e.name;
-        new_context.values = e.values;
-
-        new_context.default_entry = get_value_enum_entry(enum_meta.value_enum_default_value_style, e);
-        new_context.min_entry = get_value_enum_entry(ValueEnumDefaultValueStyle::Min, e);
-        new_context.max_entry = get_value_enum_entry(ValueEnumDefaultValueStyle::Max, e);
-        new_context.entry_count = e.values.size();
-        new_context.size_type_str = cpp_cfg.get_size_type_from_index(e.size_type_index).type_name;
-        new_context.is_size_type_signed = cpp_cfg.get_size_type_from_index(e.size_type_index).is_signed;
-        new_context.size_type_bits = cpp_cfg.get_size_type_from_index(e.size_type_index).bits;
-
-        new_context.unique_entry_count = static_cast<int64_t>(unique_values.size());
-        new_context.is_range_contiguous = is_value_set_contiguous(unique_values);
-
-        const int64_t max_abs_representable_signed =
-            std::max(
-                std::abs(static_cast<int64_t>(new_context.min_entry.p_value) - 1),
-                static_cast<int64_t>(new_context.max_entry.p_value)
-            );
-        const uint64_t max_abs_representable =
-            new_context.is_size_type_signed
-            ? max_abs_representable_signed
-            : static_cast<uint64_t>(new_context.max_entry.p_value);
-
-        new_context.bits_required_storage = get_storage_bits_required(max_abs_representable);
-        new_context.bits_required_transmission = get_transmission_bits_required(
-            new_context.max_entry.p_value - new_context.min_entry.p_value);
-
-        // Because of the way signed integers map to bit fields, a bit field may require an additional
-        // bit of storage to accommodate the sign bit even if it is unused. For example, given the following enum:
-        //   enum class ESignedValueBits : int8_t { A = 0, B = 1, C = 2, D = 3 }
-        // To properly store and assign to this enum, we need 3 bits:
-        //   int8_t Value : 1; // maps to the range -1 - 0, unexpected!
-        //   int8_t Value : 2; // maps to the range -2 - 1, still not big enough
-        //   int8_t Value : 3; // maps to the range -4 - 3, big enough, but we're wasting space
-        // For this reason, when utilizing packed enums it is recommended to always prefer an unsigned underlying
-        // type unless your enum actually contains negative values.
-        if (new_context.is_size_type_signed && (new_context.max_entry.p_value > 0)) {
-            uint64_t signed_range_max = 0;
-            for (int64_t i = 0; i < new_context.bits_required_storage - 1; i++) {
-                signed_range_max |= 1ULL << i;
-            }
-            if (static_cast<uint64_t>(new_context.max_entry.p_value) > signed_range_max) {
-                new_context.bits_required_storage += 1;
-            }
+value_enum_context cpp_generator::build_value_enum_context(const enum_definition &e, const enum_validation &validation) const {
+    const profile_scope scope("build_value_enum_context", e.name);
+    // Build Context
+    value_enum_context new_context;
+
+    new_context.enum_name = e.name;
+    new_context.values = enum_entry_span(e.values);
+
+    new_context.default_entry = &get_value_enum_entry(enum_meta.value_enum_default_value_style, e);
+    new_context.min_entry = &get_value_enum_entry(ValueEnumDefaultValueStyle::Min, e);
+    new_context.max_entry = &get_value_enum_entry(ValueEnumDefaultValueStyle::Max, e);
+    new_context.entry_count = e.values.size();
+    new_context.size_type_str = cpp_cfg.get_size_type_from_index(e.size_type_index).type_name;
+    new_context.is_size_type_signed = cpp_cfg.get_size_type_from_index(e.size_type_index).is_signed;
+    new_context.size_type_bits = cpp_cfg.get_size_type_from_index(e.size_type_index).bits;
+
+    new_context.unique_entry_count = validation.unique_entry_count;
+    new_context.is_range_contiguous = validation.is_contiguous;
+    // Enums with a single value have no string tables, their lookups are one comparison
+    new_context.out_of_line = out_of_line && e.out_of_line && e.values.size() > 1;
+
+    const int64_t max_abs_representable_signed =
+        std::max(
+            std::abs(static_cast<int64_t>(new_context.min_entry->p_value) - 1),
+            static_cast<int64_t>(new_context.max_entry->p_value)
+        );
+    const uint64_t max_abs_representable =
+        new_context.is_size_type_signed
+        ? max_abs_representable_signed
+        : static_cast<uint64_t>(new_context.max_entry->p_value);
+
+    new_context.bits_required_storage = get_storage_bits_required(max_abs_representable);
+    new_context.bits_required_transmission = get_transmission_bits_required(
+        new_context.max_entry->p_value - new_context.min_entry->p_value);
+
+    // Because of the way signed integers map to bit fields, a bit field may require an additional
+    // bit of storage to accommodate the sign bit even if it is unused. For example, given the following enum:
+    //   enum class ESignedValueBits : int8_t { A = 0, B = 1, C = 2, D = 3 }
+    // To properly store and assign to this enum, we need 3 bits:
+    //   int8_t Value : 1; // maps to the range -1 - 0, unexpected!
+    //   int8_t Value : 2; // maps to the range -2 - 1, still not big enough
+    //   int8_t Value : 3; // maps to the range -4 - 3, big enough, but we're wasting space
+    // For this reason, when utilizing packed enums it is recommended to always prefer an unsigned underlying
+    // type unless your enum actually contains negative values.
+    if (new_context.is_size_type_signed && (new_context.max_entry->p_value > 0)) {
+        uint64_t signed_range_max = 0;
+        for (int64_t i = 0; i < new_context.bits_required_storage - 1; i++) {
+            signed_range_max |= 1ULL << i;
+        }
+        if (static_cast<uint64_t>(new_context.max_entry->p_value) > signed_range_max) {
+            new_context.bits_required_storage += 1;
         }
+    }
 
-        // Determine sentinel values
-        {
+    // Determine sentinel values
+    {
 
-            const auto GetAvailableSentinel = [&]() -> std::optional<int128> {
-                // TODO: Benchmark for best sentinel to use, or if it's even worth using one at all.
+        const auto GetAvailableSentinel = [&]() -> std::optional<int128> {
+            // TODO: Benchmark for best sentinel to use, or if it's even worth using one at all.
 
-                // 0 is probably the most efficient sentinel to use if it's not already a valid value.
-                if(unique_values.find(0) == unique_values.end()) {
-                    return 0;
-                }
+            // 0 is probably the most efficient sentinel to use if it's not already a valid value.
+            if(!validation.has_zero) {
+                return 0;
+            }
 
-                // If signed, try -1
-                if(new_context.is_size_type_signed) {
-                    if (unique_values.find(-1) == unique_values.end()) {
-                        return -1;
-                    }
+            // If signed, try -1
+            if(new_context.is_size_type_signed) {
+                if (!validation.has_minus_one) {
+                    return -1;
                 }
+            }
 
-                // If unsigned, try all bits set
-                if(!new_context.is_size_type_signed) {
-                    int128 AllBitsMask = 0;
-                    for(int i = 0; i < new_context.size_type_bits; i++) {
-                        AllBitsMask |= (1ULL << i);
-                    }
-                    if (unique_values.find(AllBitsMask) == unique_values.end()) {
-                        return AllBitsMask;
-                    }
+            // If unsigned, try all bits set
+            if(!new_context.is_size_type_signed) {
+                int128 AllBitsMask = 0;
+                for(int i = 0; i < new_context.size_type_bits; i++) {
+                    AllBitsMask |= (1ULL << i);
                 }
+                if (!validation.has_all_bits) {
+                    return AllBitsMask;
+                }
+            }
 
-                // Just use a separate bool.
-                return std::nullopt;
-            };
+            // Just use a separate bool.
+            return std::nullopt;
+        };
 
-            new_context.invalid_sentinel = GetAvailableSentinel();
-        }
+        new_context.invalid_sentinel = GetAvailableSentinel();
+    }
 
-        // Generate string lookup tables
-        auto generate_string_lookup_tables = [&]() -> string_lookup_tables {
-            string_lookup_tables output;
+    // Generate string lookup tables
+    auto generate_string_lookup_tables = [&]() -> string_lookup_tables {
+        string_lookup_tables output;
 
-            // Put strings into buckets by size
-            std::map<size_t, std::vector<enum_entry>> buckets_by_size;
-            for (auto &ed: e.values) {
-                buckets_by_size[ed.name.length()].push_back(ed);
+        // Group entries into buckets by name length, in value order within a bucket
+        output.entries.reserve(e.values.size());
+        for (auto &ed: e.values) {
+            output.entries.push_back(&ed);
+        }
+        std::stable_sort(output.entries.begin(), output.entries.end(),
+                         [](const enum_entry *a, const enum_entry *b) { return a->name.length() < b->name.length(); });
+
+        size_t offset_str = 0;
+        size_t offset_enum = 0;
+        while (offset_enum < output.entries.size()) {
+            const size_t size = output.entries[offset_enum]->name.length();
+            size_t count = 0;
+            while (offset_enum + count < output.entries.size() && output.entries[offset_enum + count]->name.length() == size) {
+                count++;
             }
 
-            size_t offset_str = 0;
-            size_t offset_enum = 0;
-            for (auto &bucket: buckets_by_size) {
-                const size_t count = bucket.second.size();
+            output.tables.emplace_back(string_lookup_table{offset_str, offset_enum, count, size});
 
-                std::vector<std::string> names;
-                for (auto &entry: bucket.second) {
-                    output.entries.push_back(entry);
-                    names.push_back(entry.name);
-                }
+            // TODO: Handle Padding
+            offset_str += (size * count) + (1 * count);
+            offset_enum += count;
+        }
 
-                output.tables.emplace_back(string_lookup_table{offset_str, offset_enum, count, bucket.first, names});
+        return output;
+    };
+    new_context.string_tables = generate_string_lookup_tables();
 
-                // TODO: Handle Padding
-                offset_str += (bucket.second.front().name.length() * count) + (1 * count);
-                offset_enum += bucket.second.size();
-            }
+    new_context.is_one_string_table = std::equal(
+        e.values.cbegin(), e.values.cend(),
+        new_context.string_tables.entries.cbegin(), new_context.string_tables.entries.cend(),
+        [](const enum_entry &v, const enum_entry *s) { return &v == s; }
+    );
 
-            return output;
-        };
-        new_context.string_tables = generate_string_lookup_tables();
+    return new_context;
+}
 
-        new_context.is_one_string_table = std::equal(
-            e.values.cbegin(), e.values.cend(),
-            new_context.string_tables.entries.cbegin(), new_context.string_tables.entries.cend()
-        );
+void cpp_generator::bind_value_enum_args(const value_enum_context &e) {
+    // Build fmt args
+    push(template_slot::enum_ns, ctx.enum_ns);
+    push(template_slot::enum_ns_size, std::to_string(ctx.enum_ns.size()));
+    push(template_slot::enum_name, e.enum_name);
+    push(template_slot::enum_name_size, std::to_string(e.enum_name.size()));
+    push(template_slot::enum_detail_ns, fmt::format("::{}::detail::{}", ctx.enum_ns, e.enum_name));
+    push(template_slot::enum_name_fq, fmt::format("::{}::{}", ctx.enum_ns, e.enum_name));
+    push(template_slot::enum_name_fq_size, std::to_string(fmt::format("::{}::{}", ctx.enum_ns, e.enum_name).size()));
+    push(template_slot::enum_name_fq_no_global, fmt::format("{}::{}", ctx.enum_ns, e.enum_name));
+    push(template_slot::enum_name_fq_no_global_size, std::to_string(fmt::format("{}::{}", ctx.enum_ns, e.enum_name).size()));
+    push(template_slot::size_type, e.size_type_str);
+    push(template_slot::entry_count, std::to_string(e.entry_count));
+    push(template_slot::max_v, format_int128({e.max_entry->p_value, e.size_type_bits, e.is_size_type_signed}));
+    push(template_slot::min_v, format_int128({e.min_entry->p_value, e.size_type_bits, e.is_size_type_signed}));
+}
 
-        ctx.value_enums.emplace_back(new_context);
-    }
-
-    // VALUE ENUM DEFINITIONS
-    for (auto &e: ctx.value_enums) {
-        clear_store();
-
-        // Build fmt args
-        push("enum_ns", ctx.enum_ns);
-        push("enum_ns_size", std::to_string(ctx.enum_ns.size()));
-        push("enum_name", e.enum_name);
-        push("enum_name_size", std::to_string(e.enum_name.size()));
-        push("enum_detail_ns", fmt::format("::{}::detail::{}", ctx.enum_ns, e.enum_name));
-        push("enum_name_fq", fmt::format("::{}::{}", ctx.enum_ns, e.enum_name));
-        push("enum_name_fq_size", std::to_string(fmt::format("::{}::{}", ctx.enum_ns, e.enum_name).size()));
-        push("enum_name_fq_no_global", fmt::format("{}::{}", ctx.enum_ns, e.enum_name));
-        push("enum_name_fq_no_global_size", std::to_string(fmt::format("{}::{}", ctx.enum_ns, e.enum_name).size()));
-        push("size_type", e.size_type_str);
-        push("entry_count", std::to_string(e.entry_count));
-        push("max_v", format_int128({e.max_entry.p_value, e.size_type_bits, e.is_size_type_signed}));
-        push("min_v", format_int128({e.min_entry.p_value, e.size_type_bits, e.is_size_type_signed}));
-
-        emit_ve_definition(e);
-
-        // Helper specializations
-        wvl("template<> struct enumbra::detail::base_helper<{enum_name_fq}> : enumbra::detail::type_info<true, true, false> {{ }};");
-
-        const std::string value_helper_str =
-            fmt::format(
-                "template<> struct enumbra::detail::enum_helper<::{0}::{1}> : enumbra::detail::enum_info<{2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}, {11}> {{ }};",
-                ctx.enum_ns,
-                e.enum_name,
-                e.size_type_str,
-                Int128Format{e.min_entry.p_value, e.size_type_bits, e.is_size_type_signed},
-                Int128Format{e.max_entry.p_value, e.size_type_bits, e.is_size_type_signed},
-                Int128Format{e.default_entry.p_value, e.size_type_bits, e.is_size_type_signed},
-                e.unique_entry_count,
-                e.is_range_contiguous ? "true" : "false",
-                e.bits_required_storage,
-                e.bits_required_transmission,
-                e.invalid_sentinel.has_value() ? "true" : "false",
-                Int128Format{e.invalid_sentinel.value_or(0), e.size_type_bits, e.is_size_type_signed}
-            );
-        wlu(value_helper_str);
-        wlf();
+void cpp_generator::emit_value_enum(const value_enum_context &e) {
+    const profile_scope scope("emit_value_enum", e.enum_name);
+    bind_value_enum_args(e);
+
+    emit_ve_definition(e);
+
+    // Helper specializations
+    wvl("template<> struct enumbra::detail::base_helper<{enum_name_fq}> : enumbra::detail::type_info<true, true, false> {{ }};");
+
+    const std::string value_helper_str =
+        fmt::format(
+            "template<> struct enumbra::detail::enum_helper<::{0}::{1}> : enumbra::detail::enum_info<{2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}, {11}> {{ }};",
+            ctx.enum_ns,
+            e.enum_name,
+            e.size_type_str,
+            Int128Format{e.min_entry->p_value, e.size_type_bits, e.is_size_type_signed},
+            Int128Format{e.max_entry->p_value, e.size_type_bits, e.is_size_type_signed},
+            Int128Format{e.default_entry->p_value, e.size_type_bits, e.is_size_type_signed},
+            e.unique_entry_count,
+            e.is_range_contiguous ? "true" : "false",
+            e.bits_required_storage,
+            e.bits_required_transmission,
+            e.invalid_sentinel.has_value() ? "true" : "false",
+            Int128Format{e.invalid_sentinel.value_or(0), e.size_type_bits, e.is_size_type_signed}
+        );
+    wlu(value_helper_str);
+    wlf();
 
-        emit_ve_detail(e);
-        emit_ve_func_values(e);
-        emit_ve_func_from_integer(e);
-        emit_ve_func_is_valid(e);
-        emit_ve_func_enum_name(e);
+    emit_ve_detail(e);
+    emit_ve_func_values(e);
+    emit_ve_func_from_integer(e);
+    emit_ve_func_is_valid(e);
+    emit_ve_func_enum_name(e);
 
-        emit_ve_func_to_string(e);
-        emit_ve_func_from_string_with_size(e);
-        emit_ve_func_from_string_cstr(e);
+    emit_ve_func_to_string(e);
+    emit_ve_func_from_string_with_size(e);
+    emit_ve_func_from_string_cstr(e);
 
-        wlf();
-    }
     wlf();
+}
 
-    
+void cpp_generator::emit_value_enum_source(const value_enum_context &e) {
+    const profile_scope scope("emit_value_enum_source", e.enum_name);
+    bind_value_enum_args(e);
 
-    // Flags ENUM DEFINITIONS
-    for (auto &e: enum_meta.flag_enum_definitions) {
-        clear_store();
+    wvl("namespace {enum_ns}::detail::{enum_name} {{");
+    emit_ve_string_tables(e);
+    wlu("}");
+    wlf();
 
-        // Get references and metadata for relevant enum values that we will need
-        const uint64_t min_value = 0; // The minimum for a flags entry is always 0 - no bits set
-        uint64_t max_value = 0;
-        for (auto &v: e.values) {
-            if (v.p_value < 0) {
-                throw std::logic_error(fmt::format("Flags-Enum value is less than 0. Flags-Enum values are required to be unsigned. (Enum = {})", e.name));
-            }
-            max_value |= static_cast<uint64_t>(v.p_value);
-        }
+    emit_ve_func_to_string(e);
+    emit_ve_func_from_string_with_size(e);
+}
 
-        std::set<int128> unique_values;
-        for (auto &v: e.values) {
-            unique_values.insert(v.p_value);
-        }
-        const size_t unique_entry_count = unique_values.size();
-
-        const uint64_t default_value = get_flags_enum_value(enum_meta.flags_enum_default_value_style, e);
-
-        // const size_t entry_count = e.values.size();
-        const size_t bits_required_storage = get_storage_bits_required(max_value);
-        const size_t bits_required_transmission = bits_required_storage;
-        const std::string size_type = cpp_cfg.get_size_type_from_index(e.size_type_index).type_name;
-        const bool is_size_type_signed = cpp_cfg.get_size_type_from_index(e.size_type_index).is_signed;
-        const int64_t type_bits = cpp_cfg.get_size_type_from_index(e.size_type_index).bits;
-        if (is_size_type_signed) {
-            throw std::logic_error("Size type for flags enum is signed. enumbra requires that flags use an unsigned type.");
+void cpp_generator::emit_flags_enum(const enum_definition &e, const enum_validation &validation) {
+    const profile_scope scope("emit_flags_enum", e.name);
+    // Get references and metadata for relevant enum values that we will need
+    const uint64_t min_value = 0; // The minimum for a flags entry is always 0 - no bits set
+    uint64_t max_value = 0;
+    for (auto &v: e.values) {
+        if (v.p_value < 0) {
+            throw std::logic_error(fmt::format("Flags-Enum value is less than 0. Flags-Enum values are required to be unsigned. (Enum = {})", e.name));
         }
+        max_value |= static_cast<uint64_t>(v.p_value);
+    }
 
-        // Determine if range is contiguous
-        // Enables some minor optimizations for range-checking values if true
-        // TODO: Enforce if flag is set
-        bool is_contiguous = is_flags_set_contiguous(unique_values);
+    const size_t unique_entry_count = static_cast<size_t>(validation.unique_entry_count);
 
-        const std::string enum_name_fq = fmt::format("::{}::{}", ctx.enum_ns, e.name);
+    const uint64_t default_value = get_flags_enum_value(enum_meta.flags_enum_default_value_style, e);
 
-        push("enum_ns", ctx.enum_ns);
-        push("enum_name", e.name);
-        push("enum_detail_ns", fmt::format("::{}::detail::{}", ctx.enum_ns, e.name));
-        push("enum_name_fq", enum_name_fq);
-        push("size_type", size_type);
-        push("unique_entry_count", std::to_string(unique_entry_count));
-        push("max_value", fmt::format("{0:#x}", max_value));
+    // const size_t entry_count = e.values.size();
+    const size_t bits_required_storage = get_storage_bits_required(max_value);
+    const size_t bits_required_transmission = bits_required_storage;
+    const std::string size_type = cpp_cfg.get_size_type_from_index(e.size_type_index).type_name;
+    const bool is_size_type_signed = cpp_cfg.get_size_type_from_index(e.size_type_index).is_signed;
+    const int64_t type_bits = cpp_cfg.get_size_type_from_index(e.size_type_index).bits;
+    if (is_size_type_signed) {
+        throw std::logic_error("Size type for flags enum is signed. enumbra requires that flags use an unsigned type.");
+    }
 
-        // START NAMESPACE
-        for (const auto &ns: cpp_cfg.output_namespace) {
-            wl("namespace {} {{", ns);
-        }
+    // TODO: Enforce if flag is set
+    const bool is_contiguous = validation.is_contiguous;
 
-        // Definition
-        {
-            wvl("enum class {enum_name} : {size_type} {{");
-            for (const auto &v: e.values) {
-                wl("{} = {},", v.name, Int128Format{v.p_value, type_bits, is_size_type_signed});
-            }
-            wlu("};");
-        }
-        wlf();
+    const std::string enum_name_fq = fmt::format("::{}::{}", ctx.enum_ns, e.name);
 
-        wvl("namespace detail::{enum_name} {{");
-        wvl("constexpr {enum_name_fq} flags_arr[{unique_entry_count}] =");
-        wlu("{");
+    push(template_slot::enum_ns, ctx.enum_ns);
+    push(template_slot::enum_name, e.name);
+    push(template_slot::enum_detail_ns, fmt::format("::{}::detail::{}", ctx.enum_ns, e.name));
+    push(template_slot::enum_name_fq, enum_name_fq);
+    push(template_slot::size_type, size_type);
+    push(template_slot::unique_entry_count, std::to_string(unique_entry_count));
+    push(template_slot::max_value, fmt::format("{0:#x}", max_value));
+
+    // START NAMESPACE
+    wexport();
+    for (const auto &ns: cpp_cfg.output_namespace) {
+        wl("namespace {} {{", ns);
+    }
+
+    // Definition
+    {
+        wvl("enum class {enum_name} : {size_type} {{");
         for (const auto &v: e.values) {
-            wl("{0}::{1},", enum_name_fq, v.name);
+            wl("{} = {},", v.name, Int128Format{v.p_value, type_bits, is_size_type_signed});
         }
         wlu("};");
-        wlu("}");
-        wlf();
+    }
+    wlf();
+
+    // Inline variables like the value enum tables, see emit_ve_detail
+    wvl("namespace detail::{enum_name} {{");
+    wvl("inline constexpr {enum_name_fq} flags_arr[{unique_entry_count}] =");
+    wlu("{");
+    for (const auto &v: e.values) {
+        wl("{0}::{1},", enum_name_fq, v.name);
+    }
+    wlu("};");
+    if (!is_contiguous) {
+        // Compaction table from bit position to flag ordinal for sparse layouts
+        std::vector<int> bit_index(bits_required_storage, -1);
+        for (size_t i = 0; i < e.values.size(); i++) {
+            bit_index[log_2_unsigned(static_cast<uint64_t>(e.values[i].p_value))] = static_cast<int>(i);
+        }
+        wl("inline constexpr signed char flag_bit_index[{0}] = {{ {1} }};", bits_required_storage, fmt::join(bit_index, ", "));
+    }
+    // Implication closure tables, one per byte of the value that contains an implying flag.
+    // Each entry is the union of everything implied by the bits of that byte.
+    const std::array<uint64_t, 64> implied_masks = get_flags_implied_masks(e);
+    std::vector<size_t> closure_bytes;
+    for (size_t byte = 0; byte < 8; byte++) {
+        bool has_implications = false;
+        for (size_t bit = byte * 8; bit < (byte + 1) * 8; bit++) {
+            has_implications |= (implied_masks[bit] != 0);
+        }
+        if (!has_implications) {
+            continue;
+        }
+        closure_bytes.push_back(byte);
+        std::vector<std::string> table;
+        for (uint64_t x = 0; x < 256; x++) {
+            uint64_t implied = 0;
+            for (size_t bit = 0; bit < 8; bit++) {
+                if (x & (1ULL << bit)) {
+                    implied |= implied_masks[byte * 8 + bit];
+                }
+            }
+            table.push_back(fmt::format("{0:#x}", implied));
+        }
+        wl("inline constexpr {0} closure_table_{1}[256] = {{ {2} }};", size_type, byte, fmt::join(table, ", "));
+    }
+    wlu("}");
 
-        // END NAMESPACE
-        for (auto ns = cpp_cfg.output_namespace.rbegin(); ns != cpp_cfg.output_namespace.rend(); ++ns) {
-            wl("}} // namespace {}", *ns);
+    // Presets, names share the from_string namespace with the flags so they must not collide
+    std::vector<std::pair<const flags_preset *, uint64_t>> presets;
+    {
+        std::set<std::string> seen_names;
+        for (auto &v: e.values) {
+            seen_names.insert(v.name);
+        }
+        for (auto &p: e.presets) {
+            if (!seen_names.insert(p.name).second) {
+                throw std::logic_error(
+                    fmt::format("Flags-Enum preset name is not unique (Enum = {}, Name = {})", e.name, p.name));
+            }
+            presets.emplace_back(&p, get_flags_mask(e, p.flags));
         }
+    }
+    if (!presets.empty()) {
         wlf();
+        wvl("namespace presets::{enum_name} {{");
+        for (auto &[p, mask]: presets) {
+            wl("inline constexpr {0} {1} = static_cast<{0}>({2:#x});", enum_name_fq, p->name, mask);
+        }
+        wlu("}");
+    }
+    wlf();
 
-        wvl("namespace enumbra {{");
+    // END NAMESPACE
+    for (auto ns = cpp_cfg.output_namespace.rbegin(); ns != cpp_cfg.output_namespace.rend(); ++ns) {
+        wl("}} // namespace {}", *ns);
+    }
+    wlf();
 
-        wlu("template<>");
-        wvl("constexpr auto& flags<{enum_name_fq}>() noexcept");
-        wlu("{");
-        wvl("return {enum_detail_ns}::flags_arr;");
-        wlu("}");
-        wlf();
+    wvl("namespace enumbra {{");
 
-        wlu("template<>");
-        wvl("constexpr bool is_valid<{enum_name_fq}>({enum_name_fq} e) noexcept {{ ");
-        wvl("return (static_cast<{size_type}>(e) | static_cast<{size_type}>({max_value})) == static_cast<{size_type}>({max_value});");
-        wlu("}");
-        wlf();
+    wlu("template<>");
+    wvl("constexpr auto& flags<{enum_name_fq}>() noexcept");
+    wlu("{");
+    wvl("return {enum_detail_ns}::flags_arr;");
+    wlu("}");
+    wlf();
 
-        //// Functions
-        
-        wvl("template<> constexpr void clear({enum_name_fq}& value) noexcept {{ value = static_cast<{enum_name_fq}>(0); }}");
-        wvl("template<> constexpr bool test({enum_name_fq} value, {enum_name_fq} flags) noexcept {{ return (static_cast<{size_type}>(flags) & static_cast<{size_type}>(value)) == static_cast<{size_type}>(flags); }}");
-        wvl("template<> constexpr void set({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) | static_cast<{size_type}>(flags)); }}");
-        wvl("template<> constexpr void unset({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) & (~static_cast<{size_type}>(flags))); }}");
-        wvl("template<> constexpr void toggle({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) ^ static_cast<{size_type}>(flags)); }}");
-        
-        wvl("template<> constexpr bool has_all({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) == static_cast<{size_type}>({max_value}); }}");
-        wvl("template<> constexpr bool has_any({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) > 0; }}");
-        wvl("template<> constexpr bool has_none({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) == 0; }}");
-        wvl("template<> constexpr bool has_single({enum_name_fq} value) noexcept {{ {size_type} n = static_cast<{size_type}>(static_cast<{size_type}>(value) & {max_value}); return n && !(n & (n - 1)); }}");
-        wlf();
+    wlu("template<>");
+    wvl("constexpr bool is_valid<{enum_name_fq}>({enum_name_fq} e) noexcept {{ ");
+    wvl("return (static_cast<{size_type}>(e) | static_cast<{size_type}>({max_value})) == static_cast<{size_type}>({max_value});");
+    wlu("}");
+    wlf();
 
-        wlu("} // namespace enumbra");
-        wlf();
+    //// Functions
+    
+    wvl("template<> constexpr void clear({enum_name_fq}& value) noexcept {{ value = static_cast<{enum_name_fq}>(0); }}");
+    wvl("template<> constexpr bool test({enum_name_fq} value, {enum_name_fq} flags) noexcept {{ return (static_cast<{size_type}>(flags) & static_cast<{size_type}>(value)) == static_cast<{size_type}>(flags); }}");
+    wvl("template<> constexpr void set({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) | static_cast<{size_type}>(flags)); }}");
+    wvl("template<> constexpr void unset({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) & (~static_cast<{size_type}>(flags))); }}");
+    wvl("template<> constexpr void toggle({enum_name_fq}& value, {enum_name_fq} flags) noexcept {{ value = static_cast<{enum_name_fq}>(static_cast<{size_type}>(value) ^ static_cast<{size_type}>(flags)); }}");
+    
+    wvl("template<> constexpr bool has_all({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) == static_cast<{size_type}>({max_value}); }}");
+    wvl("template<> constexpr bool has_any({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) > 0; }}");
+    wvl("template<> constexpr bool has_none({enum_name_fq} value) noexcept {{ return (static_cast<{size_type}>(value) & static_cast<{size_type}>({max_value})) == 0; }}");
+    wvl("template<> constexpr bool has_single({enum_name_fq} value) noexcept {{ {size_type} n = static_cast<{size_type}>(static_cast<{size_type}>(value) & {max_value}); return n && !(n & (n - 1)); }}");
+    wlf();
 
-        // Helper specializations
-        wl("template<> struct enumbra::detail::base_helper<{0}> : enumbra::detail::type_info<true, false, true> {{ }};", enum_name_fq);
-
-        wl("template<> struct enumbra::detail::enum_helper<{0}> : enumbra::detail::enum_info<{1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}> {{ }};",
-            enum_name_fq,
-            size_type,
-            Int128Format{ min_value, type_bits, is_size_type_signed },
-            Int128Format{ max_value, type_bits, is_size_type_signed },
-            Int128Format{ default_value, type_bits, is_size_type_signed },
-            unique_entry_count,
-            is_contiguous ? "true" : "false",
-            bits_required_storage,
-            bits_required_transmission,
-            "false", // TODO: We could use an unused flag bit to signal invalid
-            0
-        );
-        
-        wlf();
+    // Flag index functions
+    const uint64_t lowest_flag = static_cast<uint64_t>(e.values.front().p_value);
+    if (is_contiguous) {
+        // Contiguous flags map to ordinals with a shift
+        push(template_slot::lowest_flag, fmt::format("{0:#x}", lowest_flag));
+        push(template_slot::lowest_bit, std::to_string(log_2_unsigned(lowest_flag)));
+        wvl("template<> constexpr int flag_index({enum_name_fq} flag) noexcept {{ const unsigned long long n = static_cast<unsigned long long>(flag); return ((n & (n - 1)) == 0 && n >= {lowest_flag} && n <= {max_value}) ? (::enumbra::detail::countr_zero(n) - {lowest_bit}) : -1; }}");
+        wvl("template<> constexpr {enum_name_fq} flag_from_index<{enum_name_fq}>(int index) noexcept {{ return (index >= 0 && index < {unique_entry_count}) ? static_cast<{enum_name_fq}>(1ULL << (index + {lowest_bit})) : {enum_name_fq}(); }}");
+    } else {
+        wvl("template<> constexpr int flag_index({enum_name_fq} flag) noexcept {{ const unsigned long long n = static_cast<unsigned long long>(flag); return (n != 0 && (n & (n - 1)) == 0 && n <= {max_value}) ? {enum_detail_ns}::flag_bit_index[::enumbra::detail::countr_zero(n)] : -1; }}");
+        wvl("template<> constexpr {enum_name_fq} flag_from_index<{enum_name_fq}>(int index) noexcept {{ return (index >= 0 && index < {unique_entry_count}) ? {enum_detail_ns}::flags_arr[index] : {enum_name_fq}(); }}");
+    }
+    wlf();
 
-        // Operator Overloads need to be outside of enumbra::
-        for (const auto& ns : cpp_cfg.output_namespace) {
-            wl("namespace {} {{", ns);
+    // Constraints compile to a fixed sequence of mask tests
+    wlu("template<>");
+    wvl("constexpr bool satisfies_constraints({enum_name_fq} value) noexcept {{");
+    wlu("const unsigned long long n = static_cast<unsigned long long>(value);");
+    wvl("return ((n | {max_value}) == {max_value})");
+    for (auto &group: e.constraints.exactly_one) {
+        wl("&& (::enumbra::detail::popcount(n & {0:#x}) == 1)", get_flags_mask(e, group));
+    }
+    for (auto &group: e.constraints.exclusive) {
+        wl("&& (::enumbra::detail::popcount(n & {0:#x}) <= 1)", get_flags_mask(e, group));
+    }
+    for (const auto *relations: {&e.constraints.requirements, &e.constraints.implications}) {
+        for (auto &relation: *relations) {
+            const uint64_t targets = get_flags_mask(e, relation.targets);
+            wl("&& (((n & {0:#x}) == 0) || ((n & {1:#x}) == {1:#x}))", get_flags_mask(e, {relation.flag}), targets);
         }
-        wvl("constexpr {enum_name_fq} operator~(const {enum_name_fq} a) noexcept {{ return static_cast<{enum_name_fq}>(~static_cast<{size_type}>(a)); }}");
-        wvl("constexpr {enum_name_fq} operator|(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) | static_cast<{size_type}>(b)); }}");
-        wvl("constexpr {enum_name_fq} operator&(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) & static_cast<{size_type}>(b)); }}");
-        wvl("constexpr {enum_name_fq} operator^(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) ^ static_cast<{size_type}>(b)); }}");
-        wvl("constexpr {enum_name_fq}& operator|=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a | b; }}");
-        wvl("constexpr {enum_name_fq}& operator&=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a & b; }}");
-        wvl("constexpr {enum_name_fq}& operator^=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a ^ b; }}");
-        for (auto ns = cpp_cfg.output_namespace.rbegin(); ns != cpp_cfg.output_namespace.rend(); ++ns) {
-            wl("}} // namespace {}", *ns);
+    }
+    wlu(";");
+    wlu("}");
+    wlf();
+
+    wlu("template<>");
+    wvl("constexpr {enum_name_fq} closure({enum_name_fq} value) noexcept {{");
+    if (closure_bytes.empty()) {
+        wlu("return value;");
+    } else {
+        wlu("const unsigned long long n = static_cast<unsigned long long>(value);");
+        std::vector<std::string> lookups;
+        for (size_t byte: closure_bytes) {
+            lookups.push_back(fmt::format("{}::closure_table_{}[(n >> {}) & 0xFF]", args_.get(template_slot::enum_detail_ns), byte, byte * 8));
         }
+        wl("return static_cast<{0}>(n | {1});", enum_name_fq, fmt::join(lookups, " | "));
+    }
+    wlu("}");
+    wlf();
 
-        wlf();
+    wlu("} // namespace enumbra");
+    wlf();
 
-        // Calc max string size
-        size_t max_to_string_size = 0;
-        for (const auto& v : e.values) {
-            max_to_string_size += v.name.size();
+    // Helper specializations
+    wl("template<> struct enumbra::detail::base_helper<{0}> : enumbra::detail::type_info<true, false, true> {{ }};", enum_name_fq);
+
+    wl("template<> struct enumbra::detail::enum_helper<{0}> : enumbra::detail::enum_info<{1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}> {{ }};",
+        enum_name_fq,
+        size_type,
+        Int128Format{ min_value, type_bits, is_size_type_signed },
+        Int128Format{ max_value, type_bits, is_size_type_signed },
+        Int128Format{ default_value, type_bits, is_size_type_signed },
+        unique_entry_count,
+        is_contiguous ? "true" : "false",
+        bits_required_storage,
+        bits_required_transmission,
+        "false", // TODO: We could use an unused flag bit to signal invalid
+        0
+    );
+    
+    wlf();
+
+    // Operator Overloads need to be outside of enumbra::
+    wexport();
+    for (const auto& ns : cpp_cfg.output_namespace) {
+        wl("namespace {} {{", ns);
+    }
+    wvl("constexpr {enum_name_fq} operator~(const {enum_name_fq} a) noexcept {{ return static_cast<{enum_name_fq}>(~static_cast<{size_type}>(a)); }}");
+    wvl("constexpr {enum_name_fq} operator|(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) | static_cast<{size_type}>(b)); }}");
+    wvl("constexpr {enum_name_fq} operator&(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) & static_cast<{size_type}>(b)); }}");
+    wvl("constexpr {enum_name_fq} operator^(const {enum_name_fq} a, const {enum_name_fq} b) noexcept {{ return static_cast<{enum_name_fq}>(static_cast<{size_type}>(a) ^ static_cast<{size_type}>(b)); }}");
+    wvl("constexpr {enum_name_fq}& operator|=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a | b; }}");
+    wvl("constexpr {enum_name_fq}& operator&=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a & b; }}");
+    wvl("constexpr {enum_name_fq}& operator^=({enum_name_fq}& a, const {enum_name_fq} b) noexcept {{ return a = a ^ b; }}");
+    for (auto ns = cpp_cfg.output_namespace.rbegin(); ns != cpp_cfg.output_namespace.rend(); ++ns) {
+        wl("}} // namespace {}", *ns);
+    }
+
+    wlf();
+
+    // Calc max string size
+    size_t max_to_string_size = 0;
+    for (const auto& v : e.values) {
+        max_to_string_size += v.name.size();
+    }
+    max_to_string_size += (e.values.size() - 1); // Add room for separators
+    if (e.to_string_presets) {
+        // Upper bound, every preset may be used alongside every flag
+        for (auto &[p, mask]: presets) {
+            max_to_string_size += p->name.size() + 1;
         }
-        max_to_string_size += (e.values.size() - 1); // Add room for separators
+    }
 
-        // We align to 16 bytes, taking into account the int32 size field
-        max_to_string_size += 4;
-        max_to_string_size += (16 - (max_to_string_size % 16)) % 16;
-        max_to_string_size -= 4;
-        push("max_to_string_size", std::to_string(max_to_string_size));
+    // We align to 16 bytes, taking into account the int32 size field
+    max_to_string_size += 4;
+    max_to_string_size += (16 - (max_to_string_size % 16)) % 16;
+    max_to_string_size -= 4;
+    push(template_slot::max_to_string_size, std::to_string(max_to_string_size));
 
-        // Start ns
-        wlu("namespace enumbra {");
-        wlf();
+    // Start ns
+    wexport();
+    wlu("namespace enumbra {");
+    wlf();
 
-        wvl("constexpr ::enumbra::stack_string<{max_to_string_size}> to_string(const {enum_name_fq} v) noexcept {{");
-        wvl("::enumbra::stack_string<{max_to_string_size}> output;");
+    wvl("constexpr ::enumbra::stack_string<{max_to_string_size}> to_string(const {enum_name_fq} v) noexcept {{");
+    wvl("::enumbra::stack_string<{max_to_string_size}> output;");
+    if (e.to_string_presets && !presets.empty()) {
+        // Greedy cover: presets with the most flags are tried first and must be a subset of the value.
+        // Remaining flags are written individually.
+        std::vector<std::pair<const flags_preset *, uint64_t>> greedy = presets;
+        std::stable_sort(greedy.begin(), greedy.end(), [](const auto &a, const auto &b) {
+            return std::bitset<64>(a.second).count() > std::bitset<64>(b.second).count();
+        });
+        wlu("const unsigned long long value = static_cast<unsigned long long>(v);");
+        wlu("unsigned long long remaining = value;");
+        for (auto &[p, mask]: greedy) {
+            wl("if (((value & {0:#x}) == {0:#x}) && ((remaining & {0:#x}) != 0)) {{", mask);
+            wlu("if (!output.empty()) { output.append('|'); }");
+            wl("output.append<{0}>(\"{1}\");", p->name.size(), p->name);
+            wl("remaining &= ~{0:#x}ULL;", mask);
+            wlu("}");
+        }
+        for (const auto& v : e.values) {
+            wl("if ((remaining & {0:#x}) != 0) {{", static_cast<uint64_t>(v.p_value));
+            wlu("if (!output.empty()) { output.append('|'); }");
+            wl("output.append<{0}>(\"{1}\");", v.name.size(), v.name);
+            wlu("}");
+        }
+    } else {
         bool first = true;
         for (const auto& v : e.values) {
             wl("if (static_cast<{0}>(v & {1}::{2}) > 0) {{", size_type, enum_name_fq, v.name);
@@ -598,78 +1181,87 @@ const std::string &cpp_generator::generate_cpp_output() {
             wl("output.append<{0}>(\"{1}\");", v.name.size(), v.name);
             wlu("}");
         }
-        wlu("return output;");
-        wlu("}");
+    }
+    wlu("return output;");
+    wlu("}");
 
-        wlf();
+    wlf();
 
-        std::map<size_t, std::set<std::string>> names_sorted_by_length;
-        for (const auto& v : e.values) {
-            names_sorted_by_length[v.name.size()].insert(v.name);
-        }
+    // Name to the expression that is or'd into the output
+    std::map<size_t, std::map<std::string, std::string>> names_sorted_by_length;
+    for (const auto& v : e.values) {
+        names_sorted_by_length[v.name.size()][v.name] = fmt::format("{}::{}", enum_name_fq, v.name);
+    }
+    for (auto &[p, mask]: presets) {
+        names_sorted_by_length[p->name.size()][p->name] = fmt::format("::{}::presets::{}::{}", ctx.enum_ns, e.name, p->name);
+    }
 
-        wlu("template<>");
-        wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> from_string<{enum_name_fq}>(const char* str, int len) noexcept {{");
-        wlu("if (len < 0) { return {}; } // Invalid size");
-        wlu("const char* start = str;");
-        wlu("const char* end = start;");
-        wvl("{enum_name_fq} output = {{}};");
-        wlu("for (int i = 0; i < len; ++i) {");
-        wlu("if (str[i] == '\\0') { return {}; } // Invalid: null in string");
-        wlu("end++;");
-        wlu("if ((i == (len - 1)) || (*end == '|')) {");
-        wlu("const auto check_len = end - start;");
-
-        bool firstSize = true;
-        for (auto& [length, names] : names_sorted_by_length) {
-            wl("{} (check_len == {}) {{", firstSize ? "if" : "else if", length);
-            firstSize = false;
-
-            bool firstName = true;
-            for (auto& name : names) {
-                const char* ifelsename = firstName ? "if" : "else if";
-                wl("{} (::enumbra::detail::streq_fixed_size<{}>(start, \"{}\")) {{ output |= {}::{}; }}", ifelsename, length, name, enum_name_fq, name);
-                firstName = false;
-            }
-            wlu("else { return {}; }");
-            wlu("}");
+    wlu("template<>");
+    wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> from_string<{enum_name_fq}>(const char* str, int len) noexcept {{");
+    wlu("if (len < 0) { return {}; } // Invalid size");
+    wlu("const char* start = str;");
+    wlu("const char* end = start;");
+    wvl("{enum_name_fq} output = {{}};");
+    wlu("for (int i = 0; i < len; ++i) {");
+    wlu("if (str[i] == '\\0') { return {}; } // Invalid: null in string");
+    wlu("end++;");
+    wlu("if ((i == (len - 1)) || (*end == '|')) {");
+    wlu("const auto check_len = end - start;");
+
+    bool firstSize = true;
+    for (auto& [length, names] : names_sorted_by_length) {
+        wl("{} (check_len == {}) {{", firstSize ? "if" : "else if", length);
+        firstSize = false;
+
+        bool firstName = true;
+        for (auto& [name, expression] : names) {
+            const char* ifelsename = firstName ? "if" : "else if";
+            wl("{} (::enumbra::detail::streq_fixed_size<{}>(start, \"{}\")) {{ output |= {}; }}", ifelsename, length, name, expression);
+            firstName = false;
         }
-
         wlu("else { return {}; }");
-        wlu("start = end + 1;");
-        wlu("}");
-        wlu("}");
-        wvl("return ::enumbra::optional_value<{enum_name_fq}>(output);");
         wlu("}");
+    }
 
-        wlf();
+    wlu("else { return {}; }");
+    wlu("start = end + 1;");
+    wlu("}");
+    wlu("}");
+    wvl("return ::enumbra::optional_value<{enum_name_fq}>(output);");
+    wlu("}");
 
-        wlu("template<>");
-        wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> from_string<{enum_name_fq}>(const char* str) noexcept {{");
-        wlu("    const int len = ::enumbra::detail::strlen(str);");
-        wvl("    return ::enumbra::from_string<{enum_name_fq}>(str, len);");
-        wlu("}");
+    wlf();
 
-        // End ns
-        wlu("} // namespace enumbra");
-        wlf();
-    }
+    wlu("template<>");
+    wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> from_string<{enum_name_fq}>(const char* str) noexcept {{");
+    wlu("    const int len = ::enumbra::detail::strlen(str);");
+    wvl("    return ::enumbra::from_string<{enum_name_fq}>(str, len);");
+    wlu("}");
 
-    emit_include_guard_end();
-    
-    // Hash the whole file to generate a unique include guard
-    const fnv1a_64_hash hash = fnv1a_64(output);
-    std::string hash_str = fmt::format("ENUMBRA_{0:X}_H", hash);
-    for (const size_t location : ctx.header_guard_positions) {
-        output.replace(output.begin() + location, output.begin() + location + hash_str.size(), hash_str);
+    // Batch kernels, the generic templates handle scalar codegen
+    if (cpp_cfg.simd_codegen != SIMDCodeGen::Scalar64 && cpp_cfg.simd_codegen != SIMDCodeGen::Scalar32) {
+        // AVX has no 256-bit integer ops, so it shares the SSE2 kernels
+        push(template_slot::simd_backend, cpp_cfg.simd_codegen == SIMDCodeGen::AVX2 ? "best" : "sse2");
+        wlf();
+        wlu("#if defined(ENUMBRA_SIMD_SSE2)");
+        wvl("template<> inline int test_all_batch<{enum_name_fq}>(const {enum_name_fq}* values, int count, {enum_name_fq} flags, unsigned long long* selection) noexcept {{ return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, true>(values, count, flags, selection); }}");
+        wvl("template<> inline int test_all_batch<{enum_name_fq}>(const {enum_name_fq}* values, int count, {enum_name_fq} flags, int* indices) noexcept {{ return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, true>(values, count, flags, indices); }}");
+        wvl("template<> inline int test_any_batch<{enum_name_fq}>(const {enum_name_fq}* values, int count, {enum_name_fq} flags, unsigned long long* selection) noexcept {{ return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, false>(values, count, flags, selection); }}");
+        wvl("template<> inline int test_any_batch<{enum_name_fq}>(const {enum_name_fq}* values, int count, {enum_name_fq} flags, int* indices) noexcept {{ return ::enumbra::detail::simd::test_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, false>(values, count, flags, indices); }}");
+        wvl("template<> inline int count_matching<{enum_name_fq}>(const {enum_name_fq}* values, int count, {enum_name_fq} all_of, {enum_name_fq} none_of) noexcept {{ return ::enumbra::detail::simd::count_matching<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}>(values, count, all_of, none_of); }}");
+        wvl("template<> inline void set_batch<{enum_name_fq}>({enum_name_fq}* values, int count, {enum_name_fq} flags) noexcept {{ ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, true>(values, count, flags); }}");
+        wvl("template<> inline void unset_batch<{enum_name_fq}>({enum_name_fq}* values, int count, {enum_name_fq} flags) noexcept {{ ::enumbra::detail::simd::modify_batch<::enumbra::detail::simd::{simd_backend}, {enum_name_fq}, {size_type}, false>(values, count, flags); }}");
+        wlu("#endif");
     }
 
-    return output;
+    // End ns
+    wlu("} // namespace enumbra");
+    wlf();
 }
 
 void cpp_generator::emit_required_macros() {
-    // Increment this if macros below are modified.
-    const int enumbra_required_macros_version = 9;
+    const profile_scope scope("emit_required_macros");
+    // Increment enumbra_required_macros_version if macros below are modified.
     const std::string macro_strings = R"(
 #if !defined(ENUMBRA_REQUIRED_MACROS_VERSION)
 #define ENUMBRA_REQUIRED_MACROS_VERSION {0}
@@ -711,6 +1303,7 @@ void cpp_generator::emit_required_macros() {
 }
 
 void cpp_generator::emit_preamble() {
+    const profile_scope scope("emit_preamble");
     wlu("// THIS FILE WAS GENERATED BY A TOOL: https://github.com/Scaless/enumbra");
     wlu("// It is highly recommended that you not make manual edits to this file,");
     wlu("// as they will be overwritten when the file is re-generated.");
@@ -734,26 +1327,28 @@ void cpp_generator::emit_preamble() {
 }
 
 void cpp_generator::emit_include_guard_begin() {
-    ctx.header_guard_positions.push_back(output.size() + 8);
+    ctx.header_guard_positions.push_back(output_position() + 8);
     wlu("#ifndef ENUMBRA_0000000000000000_H");
-    ctx.header_guard_positions.push_back(output.size() + 8);
+    ctx.header_guard_positions.push_back(output_position() + 8);
     wlu("#define ENUMBRA_0000000000000000_H");
     wlf();
 }
 
 void cpp_generator::emit_include_guard_end()
 {
-    ctx.header_guard_positions.push_back(output.size() + 10);
+    ctx.header_guard_positions.push_back(output_position() + 10);
     wlu("#endif // ENUMBRA_0000000000000000_H");
 }
 
 void cpp_generator::emit_includes() {
+    const profile_scope scope("emit_includes");
     for (const auto &inc: cpp_cfg.additional_includes) {
         wl("#include {}", inc);
     }
 }
 
 void cpp_generator::emit_optional_macros() {
+    const profile_scope scope("emit_optional_macros");
     if (cpp_cfg.enumbra_bitfield_macros) {
         // Increment this if macros below are modified.
         const int enumbra_optional_macros_version = 10;
@@ -801,12 +1396,12 @@ void cpp_generator::emit_optional_macros() {
 }
 
 void cpp_generator::emit_templates() {
-    // Increment this if templates below are modified.
-    const int enumbra_templates_version = 31;
+    const profile_scope scope("emit_templates");
+    // Increment enumbra_templates_version if templates below are modified.
     const std::string str_templates = R"(
 #if !defined(ENUMBRA_BASE_TEMPLATES_VERSION)
 #define ENUMBRA_BASE_TEMPLATES_VERSION {0}
-namespace enumbra {{
+{1}namespace enumbra {{
     namespace detail {{
         // Re-Implementation of std:: features to avoid including std headers
         template<bool B, class T, class F>
@@ -882,6 +1477,40 @@ namespace enumbra {{
             while (a[count] != 0) {{ count++; }}
             return count;
         }}
+        // Number of set bits
+        constexpr int popcount(unsigned long long v) noexcept {{
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(v);
+#else
+            v = v - ((v >> 1) & 0x5555555555555555ULL);
+            v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+        }}
+        // Position of the lowest set bit, v must not be 0
+        constexpr int countr_zero(unsigned long long v) noexcept {{
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(v);
+#else
+            return popcount((v & (~v + 1)) - 1);
+#endif
+        }}
+        // Position of the highest set bit, v must not be 0
+        constexpr int highest_bit(unsigned long long v) noexcept {{
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(v);
+#else
+            int bit = 0;
+            if (v >> 32) {{ v >>= 32; bit += 32; }}
+            if (v >> 16) {{ v >>= 16; bit += 16; }}
+            if (v >> 8) {{ v >>= 8; bit += 8; }}
+            if (v >> 4) {{ v >>= 4; bit += 4; }}
+            if (v >> 2) {{ v >>= 2; bit += 2; }}
+            if (v >> 1) {{ bit += 1; }}
+            return bit;
+#endif
+        }}
     }} // end namespace enumbra::detail
 
     template<class T>
@@ -985,9 +1614,9 @@ namespace enumbra {{
             }}
         }}
 
-        constexpr bool has_value() const {{ return operator bool(); }}
+        constexpr bool has_value() const {{ return static_cast<bool>(*this); }}
         constexpr T value() const {{ return v; }}
-        constexpr T value_or(T default_value) const {{ return operator bool() ? v : default_value; }}
+        constexpr T value_or(T default_value) const {{ return static_cast<bool>(*this) ? v : default_value; }}
     }};
 
     struct string_view {{
@@ -1080,6 +1709,44 @@ namespace enumbra {{
     template<class T>
     constexpr bool has_single(T value) noexcept = delete;
 
+    // True if value only contains defined flags and meets every constraint declared in the schema
+    template<class T>
+    constexpr bool satisfies_constraints(T value) noexcept = delete;
+
+    // Sets every flag implied by the flags in value
+    template<class T>
+    constexpr T closure(T value) noexcept = delete;
+
+    // Ordinal of a single flag within flags<T>(), or -1 if flag is not exactly one defined flag
+    template<class T>
+    constexpr int flag_index(T flag) noexcept = delete;
+
+    // Inverse of flag_index, returns T() if index is out of range
+    template<class T>
+    constexpr T flag_from_index(int index) noexcept = delete;
+
+    template<class T>
+    constexpr int count_set(T value) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        return detail::popcount(static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max));
+    }}
+
+    // Returns the lowest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T lowest_set(T value) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>(n & (~n + 1));
+    }}
+
+    // Returns the highest defined flag set in value, or T() if none are set
+    template<class T>
+    constexpr T highest_set(T value) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        const unsigned long long n = static_cast<unsigned long long>(value) & static_cast<unsigned long long>(detail::enum_helper<T>::max);
+        return static_cast<T>((n != 0) ? (1ULL << detail::highest_bit(n)) : 0ULL);
+    }}
+
     template<typename Value, typename Func>
     constexpr void flags_switch(Value v, Func&& func) {{
         static_assert(::enumbra::is_enumbra_flags_enum<Value>, "Value is not an enumbra flags enum");
@@ -1090,6 +1757,81 @@ namespace enumbra {{
         }}
     }}
 
+    // Batch operations over contiguous arrays of flags values.
+    // selection receives one bit per value and must hold at least (count + 63) / 64 words.
+    // indices receives the index of each matching value and must hold at least count entries.
+    // Each returns the number of matching values. Generated headers may specialize these with SIMD kernels.
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {{
+            if ((i % 64) == 0) {{ selection[i / 64] = 0; }}
+            if (::enumbra::test(values[i], flags)) {{
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }}
+        }}
+        return matches;
+    }}
+
+    template<class T>
+    constexpr int test_all_batch(const T* values, int count, T flags, int* indices) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {{
+            if (::enumbra::test(values[i], flags)) {{ indices[matches++] = i; }}
+        }}
+        return matches;
+    }}
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {{
+            if ((i % 64) == 0) {{ selection[i / 64] = 0; }}
+            if (::enumbra::has_any(values[i] & flags)) {{
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }}
+        }}
+        return matches;
+    }}
+
+    template<class T>
+    constexpr int test_any_batch(const T* values, int count, T flags, int* indices) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {{
+            if (::enumbra::has_any(values[i] & flags)) {{ indices[matches++] = i; }}
+        }}
+        return matches;
+    }}
+
+    // Counts values that have every flag in all_of set and every flag in none_of unset.
+    template<class T>
+    constexpr int count_matching(const T* values, int count, T all_of, T none_of) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        int matches = 0;
+        for (int i = 0; i < count; ++i) {{
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) {{ ++matches; }}
+        }}
+        return matches;
+    }}
+
+    template<class T>
+    constexpr void set_batch(T* values, int count, T flags) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) {{ ::enumbra::set(values[i], flags); }}
+    }}
+
+    template<class T>
+    constexpr void unset_batch(T* values, int count, T flags) noexcept {{
+        static_assert(::enumbra::is_enumbra_flags_enum<T>, "T is not an enumbra flags enum");
+        for (int i = 0; i < count; ++i) {{ ::enumbra::unset(values[i], flags); }}
+    }}
+
     // End Default Templates
 }} // end namespace enumbra
 #else // check existing version supported
@@ -1102,12 +1844,209 @@ namespace enumbra {{
 #endif // check existing version supported
 #endif // ENUMBRA_BASE_TEMPLATES_VERSION)";
 
-    wl(str_templates, enumbra_templates_version);
+    wl(str_templates, enumbra_templates_version, module_unit ? "export " : "");
+    wlf();
+}
+
+void cpp_generator::emit_simd_templates() {
+    const profile_scope scope("emit_simd_templates");
+    if (cpp_cfg.simd_codegen == SIMDCodeGen::Scalar64 || cpp_cfg.simd_codegen == SIMDCodeGen::Scalar32) {
+        return;
+    }
+
+    // This block is identical for every SIMDCodeGen setting so that headers generated with different
+    // settings can be included together. Each flags enum picks its backend when it is specialized.
+    // Increment this if templates below are modified.
+    const int enumbra_simd_templates_version = 1;
+    const std::string str_templates = R"(
+#if !defined(ENUMBRA_SIMD_TEMPLATES_VERSION)
+#define ENUMBRA_SIMD_TEMPLATES_VERSION {0}
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ENUMBRA_SIMD_SSE2
+#if defined(__AVX2__)
+#define ENUMBRA_SIMD_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+{1}namespace enumbra::detail::simd {{
+    constexpr int popcount(unsigned int m) noexcept {{
+        m = m - ((m >> 1) & 0x55555555u);
+        m = (m & 0x33333333u) + ((m >> 2) & 0x33333333u);
+        return static_cast<int>((((m + (m >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+    }}
+
+    struct sse2 {{
+        using vec = __m128i;
+        static constexpr int width = 16;
+        template<class T> static vec load(const T* p) noexcept {{ return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(p))); }}
+        template<class T> static void store(T* p, vec v) noexcept {{ _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), v); }}
+        static vec zero() noexcept {{ return _mm_setzero_si128(); }}
+        static vec and_(vec a, vec b) noexcept {{ return _mm_and_si128(a, b); }}
+        static vec or_(vec a, vec b) noexcept {{ return _mm_or_si128(a, b); }}
+        static vec andnot(vec a, vec b) noexcept {{ return _mm_andnot_si128(a, b); }}
+        template<class U> static vec broadcast(U v) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return _mm_set1_epi8(static_cast<char>(v)); }}
+            else if constexpr (sizeof(U) == 2) {{ return _mm_set1_epi16(static_cast<short>(v)); }}
+            else if constexpr (sizeof(U) == 4) {{ return _mm_set1_epi32(static_cast<int>(v)); }}
+            else {{ return _mm_set1_epi64x(static_cast<long long>(v)); }}
+        }}
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return _mm_cmpeq_epi8(a, b); }}
+            else if constexpr (sizeof(U) == 2) {{ return _mm_cmpeq_epi16(a, b); }}
+            else if constexpr (sizeof(U) == 4) {{ return _mm_cmpeq_epi32(a, b); }}
+            else {{ const vec c = _mm_cmpeq_epi32(a, b); return _mm_and_si128(c, _mm_shuffle_epi32(c, 0xB1)); }}
+        }}
+        // One bit per lane of a comparison result
+        template<class U> static unsigned int lane_mask(vec m) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return static_cast<unsigned int>(_mm_movemask_epi8(m)); }}
+            else if constexpr (sizeof(U) == 2) {{ return static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()))); }}
+            else if constexpr (sizeof(U) == 4) {{ return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(m))); }}
+            else {{ return static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(m))); }}
+        }}
+    }};
+
+#if defined(ENUMBRA_SIMD_AVX2)
+    struct avx2 {{
+        using vec = __m256i;
+        static constexpr int width = 32;
+        template<class T> static vec load(const T* p) noexcept {{ return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(p))); }}
+        template<class T> static void store(T* p, vec v) noexcept {{ _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(p)), v); }}
+        static vec zero() noexcept {{ return _mm256_setzero_si256(); }}
+        static vec and_(vec a, vec b) noexcept {{ return _mm256_and_si256(a, b); }}
+        static vec or_(vec a, vec b) noexcept {{ return _mm256_or_si256(a, b); }}
+        static vec andnot(vec a, vec b) noexcept {{ return _mm256_andnot_si256(a, b); }}
+        template<class U> static vec broadcast(U v) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return _mm256_set1_epi8(static_cast<char>(v)); }}
+            else if constexpr (sizeof(U) == 2) {{ return _mm256_set1_epi16(static_cast<short>(v)); }}
+            else if constexpr (sizeof(U) == 4) {{ return _mm256_set1_epi32(static_cast<int>(v)); }}
+            else {{ return _mm256_set1_epi64x(static_cast<long long>(v)); }}
+        }}
+        template<class U> static vec cmpeq(vec a, vec b) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return _mm256_cmpeq_epi8(a, b); }}
+            else if constexpr (sizeof(U) == 2) {{ return _mm256_cmpeq_epi16(a, b); }}
+            else if constexpr (sizeof(U) == 4) {{ return _mm256_cmpeq_epi32(a, b); }}
+            else {{ return _mm256_cmpeq_epi64(a, b); }}
+        }}
+        // One bit per lane of a comparison result. packs works per 128-bit half, so restore lane order.
+        template<class U> static unsigned int lane_mask(vec m) noexcept {{
+            if constexpr (sizeof(U) == 1) {{ return static_cast<unsigned int>(_mm256_movemask_epi8(m)); }}
+            else if constexpr (sizeof(U) == 2) {{ return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(m, _mm256_setzero_si256()), 0xD8))) & 0xFFFFu; }}
+            else if constexpr (sizeof(U) == 4) {{ return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }}
+            else {{ return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }}
+        }}
+    }};
+    using best = avx2;
+#else
+    using best = sse2;
+#endif
+
+    // Kernels process whole vectors, then finish the tail with the per-value specializations.
+    // U is the underlying type of T, lanes always divides 64 so a vector never straddles a selection word.
+    template<class B, class T, class U, bool all>
+    inline typename B::vec test_vec(const T* values, typename B::vec f) noexcept {{
+        return B::template cmpeq<U>(B::and_(B::load(values), f), all ? f : B::zero());
+    }}
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, unsigned long long* selection) noexcept {{
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {{
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) {{ m = ~m & lane_bits; }}
+            if ((i % 64) == 0) {{ selection[i / 64] = 0; }}
+            selection[i / 64] |= static_cast<unsigned long long>(m) << (i % 64);
+            matches += popcount(m);
+        }}
+        for (; i < count; ++i) {{
+            if ((i % 64) == 0) {{ selection[i / 64] = 0; }}
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) {{
+                selection[i / 64] |= (1ULL << (i % 64));
+                ++matches;
+            }}
+        }}
+        return matches;
+    }}
+
+    template<class B, class T, class U, bool all>
+    inline int test_batch(const T* values, int count, T flags, int* indices) noexcept {{
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        constexpr unsigned int lane_bits = (lanes >= 32) ? 0xFFFFFFFFu : ((1u << (lanes % 32)) - 1u);
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {{
+            unsigned int m = B::template lane_mask<U>(test_vec<B, T, U, all>(values + i, f));
+            if constexpr (!all) {{ m = ~m & lane_bits; }}
+            // Branchless compaction: always write, only advance on a match
+            for (int l = 0; l < lanes; ++l) {{
+                indices[matches] = i + l;
+                matches += static_cast<int>((m >> l) & 1u);
+            }}
+        }}
+        for (; i < count; ++i) {{
+            const bool match = all ? ::enumbra::test(values[i], flags) : ::enumbra::has_any(values[i] & flags);
+            if (match) {{ indices[matches++] = i; }}
+        }}
+        return matches;
+    }}
+
+    template<class B, class T, class U>
+    inline int count_matching(const T* values, int count, T all_of, T none_of) noexcept {{
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec a = B::template broadcast<U>(static_cast<U>(all_of));
+        const typename B::vec n = B::template broadcast<U>(static_cast<U>(none_of));
+        int matches = 0;
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {{
+            const typename B::vec v = B::load(values + i);
+            const typename B::vec has_all_of = B::template cmpeq<U>(B::and_(v, a), a);
+            const typename B::vec has_none_of = B::template cmpeq<U>(B::and_(v, n), B::zero());
+            matches += popcount(B::template lane_mask<U>(B::and_(has_all_of, has_none_of)));
+        }}
+        for (; i < count; ++i) {{
+            if (::enumbra::test(values[i], all_of) && !::enumbra::has_any(values[i] & none_of)) {{ ++matches; }}
+        }}
+        return matches;
+    }}
+
+    template<class B, class T, class U, bool set>
+    inline void modify_batch(T* values, int count, T flags) noexcept {{
+        constexpr int lanes = B::width / static_cast<int>(sizeof(U));
+        const typename B::vec f = B::template broadcast<U>(static_cast<U>(flags));
+        int i = 0;
+        for (; (i + lanes) <= count; i += lanes) {{
+            const typename B::vec v = B::load(values + i);
+            B::store(values + i, set ? B::or_(v, f) : B::andnot(f, v));
+        }}
+        for (; i < count; ++i) {{
+            if constexpr (set) {{ ::enumbra::set(values[i], flags); }} else {{ ::enumbra::unset(values[i], flags); }}
+        }}
+    }}
+}} // end namespace enumbra::detail::simd
+#endif // SSE2 available
+#else // check existing version supported
+#if (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) == 0
+#error ENUMBRA_SIMD_TEMPLATES_VERSION has been defined without a proper version number. Check your build system.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) < {0}
+#error An included header was generated using a newer version of enumbra. Regenerate your headers using same version of enumbra.
+#elif (ENUMBRA_SIMD_TEMPLATES_VERSION + 0) > {0}
+#error An included header was generated using an older version of enumbra. Regenerate your headers using same version of enumbra.
+#endif // check existing version supported
+#endif // ENUMBRA_SIMD_TEMPLATES_VERSION)";
+
+    wl(str_templates, enumbra_simd_templates_version, module_unit ? "export " : "");
     wlf();
 }
 
 void cpp_generator::emit_ve_definition(const value_enum_context &e) {
     // START NAMESPACE
+    wexport();
     wvl("namespace {enum_ns} {{");
 
     // Definition
@@ -1124,48 +2063,59 @@ void cpp_generator::emit_ve_definition(const value_enum_context &e) {
 
 void cpp_generator::emit_ve_detail(const value_enum_context &e) {
     
-    const auto& enum_name_fq = store_map_.at("enum_name_fq");
+    const auto& enum_name_fq = args_.get(template_slot::enum_name_fq);
 
     // begin detail namespace
     wvl("namespace {enum_ns}::detail::{enum_name} {{");
 
+    // Tables are inline variables: one definition per program instead of an internal copy in every translation unit
+    // that uses them. Module units need them too, exported functions can't reference internal linkage names.
     // values_arr
-    wvl("constexpr {enum_name_fq} values_arr[{entry_count}] =");
+    wvl("inline constexpr {enum_name_fq} values_arr[{entry_count}] =");
     wlu("{");
     for (const auto &v: e.values) {
         wl("{0}::{1},", enum_name_fq, v.name);
     }
     wlu("};");
 
+    if (!e.out_of_line) {
+        emit_ve_string_tables(e);
+    }
+
+    // End detail namespace
+    wlu("}");
+
+    wlf();
+}
+
+void cpp_generator::emit_ve_string_tables(const value_enum_context &e) {
+
+    const auto& enum_name_fq = args_.get(template_slot::enum_name_fq);
+
     if (e.values.size() > 1) {
         // enum_strings
         size_t total_char_count = 0;
-        for (auto &s: e.string_tables.entries) {
-            total_char_count += s.name.size();
+        for (auto *s: e.string_tables.entries) {
+            total_char_count += s->name.size();
             total_char_count += 1; // null terminator
         }
         total_char_count += 1; // Final terminator
 
-        wl("constexpr const char enum_strings[{0}] = {{", total_char_count);
-        for (auto &s: e.string_tables.entries) {
-            wl(R"("{0}\0")", s.name);
+        wl("inline constexpr const char enum_strings[{0}] = {{", total_char_count);
+        for (auto *s: e.string_tables.entries) {
+            wl(R"("{0}\0")", s->name);
         }
         wlu("};");
 
         if (!e.is_one_string_table) {
             // enum_string_values
-            wvl("constexpr {enum_name_fq} enum_string_values[{entry_count}] = {{");
-            for (auto &v: e.string_tables.entries) {
-                wl("{0}::{1},", enum_name_fq, v.name);
+            wvl("inline constexpr {enum_name_fq} enum_string_values[{entry_count}] = {{");
+            for (auto *v: e.string_tables.entries) {
+                wl("{0}::{1},", enum_name_fq, v->name);
             }
             wlu("};");
         }
     }
-
-    // End detail namespace
-    wlu("}");
-
-    wlf();
 }
 
 void cpp_generator::emit_ve_func_values(const value_enum_context &) {
@@ -1189,7 +2139,7 @@ void cpp_generator::emit_ve_func_from_integer(const value_enum_context &e) {
         wlu("}");
     } else if (e.is_range_contiguous) {
         // Unsigned values can't go below 0 so we just need to check that we're <= max
-        if ((e.min_entry.p_value == 0) && !e.is_size_type_signed) {
+        if ((e.min_entry->p_value == 0) && !e.is_size_type_signed) {
             wvl("if(v <= {max_v}) {{ return ::enumbra::optional_value<{enum_name_fq}>(static_cast<{enum_name_fq}>(v)); }}");
             wvl("return {{}};");
             wlu("}");
@@ -1220,7 +2170,7 @@ void cpp_generator::emit_ve_func_is_valid(const value_enum_context& e)
     }
     else if (e.is_range_contiguous) {
         // Unsigned values can't go below 0 so we just need to check that we're <= max
-        if ((e.min_entry.p_value == 0) && !e.is_size_type_signed) {
+        if ((e.min_entry->p_value == 0) && !e.is_size_type_signed) {
             wvl("return static_cast<{size_type}>(e) <= {max_v};");
         }
         else {
@@ -1264,13 +2214,22 @@ void cpp_generator::emit_ve_func_enum_name(const value_enum_context& /*e*/)
 
 void cpp_generator::emit_ve_func_to_string(const value_enum_context &e) {
     
-    const auto& enum_name_fq = store_map_.at("enum_name_fq");
-    const auto& enum_ns = store_map_.at("enum_ns");
+    const auto& enum_name_fq = args_.get(template_slot::enum_name_fq);
+    const auto& enum_ns = args_.get(template_slot::enum_ns);
     
     // START NAMESPACE
+    wexport();
     wlu("namespace enumbra {");
 
-    wvl("constexpr ::enumbra::string_view to_string(const {enum_name_fq} v) noexcept {{");
+    if (e.out_of_line && !source_unit) {
+        wvl("::enumbra::string_view to_string(const {enum_name_fq} v) noexcept;");
+        wlu("}");
+        wlf();
+        return;
+    }
+
+    wconstexpr(e);
+    wvl("::enumbra::string_view to_string(const {enum_name_fq} v) noexcept {{");
     wlu("switch (v) {");
     if (e.string_tables.entries.size() == 1) {
         for (auto &v: e.values) {
@@ -1279,7 +2238,8 @@ void cpp_generator::emit_ve_func_to_string(const value_enum_context &e) {
     } else {
         for (auto &entry: e.string_tables.tables) {
             size_t offset = entry.offset_str;
-            for (auto &e_name: entry.names) {
+            for (size_t i = entry.offset_enum; i < entry.offset_enum + entry.count; i++) {
+                const std::string &e_name = e.string_tables.entries[i]->name;
                 wl("case {0}::{1}: return {{ &::{2}::detail::{3}::enum_strings[{4}], {5} }};",
                     enum_name_fq, e_name, enum_ns, e.enum_name, offset, e_name.size());
                 offset += entry.size + 1;
@@ -1297,9 +2257,9 @@ void cpp_generator::emit_ve_func_to_string(const value_enum_context &e) {
 
 void cpp_generator::emit_ve_func_from_string_with_size(const value_enum_context &e) {
     if (e.values.size() == 1) {
-        const auto &v = e.values.at(0);
-        push("entry_name", v.name);
-        push("entry_name_len", std::to_string(v.name.length()));
+        const auto &v = e.values[0];
+        push(template_slot::entry_name, v.name);
+        push(template_slot::entry_name_len, std::to_string(v.name.length()));
         wlu("template<>");
         wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str, int len) noexcept {{");
         wvl("if ((len == {entry_name_len}) && ::enumbra::detail::streq_fixed_size<{entry_name_len}>(\"{entry_name}\", str)) {{");
@@ -1307,21 +2267,25 @@ void cpp_generator::emit_ve_func_from_string_with_size(const value_enum_context
         wlu("}");
         wlu("return {};");
         wlu("}");
-        pop("entry_name");
-        pop("entry_name_len");
+        pop(template_slot::entry_name);
+        pop(template_slot::entry_name_len);
+    } else if (e.out_of_line && !source_unit) {
+        wlu("template<>");
+        wvl("::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str, int len) noexcept;");
     } else {
         wlu("template<>");
-        wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str, int len) noexcept {{");
+        wconstexpr(e);
+        wvl("::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str, int len) noexcept {{");
         if (e.string_tables.tables.size() == 1) {
             auto &first = e.string_tables.tables.front();
-            push("entry_name_len", std::to_string(first.size));
+            push(template_slot::entry_name_len, std::to_string(first.size));
             wvl("if(len != {entry_name_len}) {{ return {{}}; }}");
             wl("constexpr int offset_str = {0};", first.offset_str);
             wl("constexpr int offset_enum = {0};", first.offset_enum);
             wl("constexpr int count = {0};", first.count);
             wlu("for (int i = 0; i < count; i++) {");
             wvl("if (::enumbra::detail::streq_fixed_size<{entry_name_len}>({enum_detail_ns}::enum_strings + offset_str + (i * (len + 1)), str)) {{");
-            pop("entry_name_len");
+            pop(template_slot::entry_name_len);
         } else {
             wlu("int offset_str = 0;");
             wlu("int offset_enum = 0;");
@@ -1351,10 +2315,11 @@ void cpp_generator::emit_ve_func_from_string_with_size(const value_enum_context
     wlf();
 }
 
-void cpp_generator::emit_ve_func_from_string_cstr(const value_enum_context& /*e*/)
+void cpp_generator::emit_ve_func_from_string_cstr(const value_enum_context& e)
 {
     wlu("template<>");
-    wvl("constexpr ::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str) noexcept {{");
+    winline_or_constexpr(e);
+    wvl("::enumbra::optional_value<{enum_name_fq}> enumbra::from_string<{enum_name_fq}>(const char* str) noexcept {{");
     wvl("const int len = ::enumbra::detail::strlen(str);");
     wvl("return ::enumbra::from_string<{enum_name_fq}>(str, len);");
     wlu("}");
@@ -2,6 +2,9 @@
 
 #include "enumbra.h"
 #include "cpp_utility.h"
+#include "cpp_template.h"
+#include "fragment_cache.h"
+#include "output_file.h"
 
 #include <array>
 #include <string>
@@ -9,32 +12,70 @@
 #include <unordered_map>
 #include <optional>
 #include <fmt/format.h>
-#include <fmt/args.h>
+#include <fmt/ranges.h>
 
 #include <type_traits>
 
 using namespace std::string_view_literals;
 using namespace std::string_literals;
 
+// Entries of a table are entries[offset_enum, offset_enum + count)
 struct string_lookup_table {
     size_t offset_str = 0;
     size_t offset_enum = 0;
     size_t count = 0;
     size_t size = 0;
-    std::vector<std::string> names;
 };
 struct string_lookup_tables {
     std::vector<string_lookup_table> tables;
-    std::vector<enumbra::enum_entry> entries;
+    std::vector<const enumbra::enum_entry*> entries; // Ordered by name length, points into the enum definition
 };
 
+// Read-only view of the entries of an enum definition, contexts reference entries instead of copying them
+class enum_entry_span {
+public:
+    enum_entry_span() = default;
+    explicit enum_entry_span(const std::vector<enumbra::enum_entry>& values) : data_(values.data()), size_(values.size()) { }
+
+    [[nodiscard]] const enumbra::enum_entry* begin() const { return data_; }
+    [[nodiscard]] const enumbra::enum_entry* end() const { return data_ + size_; }
+    [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] const enumbra::enum_entry& operator[](size_t i) const { return data_[i]; }
+
+private:
+    const enumbra::enum_entry* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Results of validating an enum, computed once per enum and shared with context building and emission
+struct enum_validation {
+    int64_t unique_entry_count = 0;
+    bool is_contiguous = false; // Value enums: consecutive values. Flags enums: consecutive bits.
+    bool has_zero = false;
+    bool has_minus_one = false;
+    bool has_all_bits = false; // All bits of the size type set
+};
+
+// Validation results of every enum of a schema
+struct schema_validation {
+    std::vector<enum_validation> value_enums;
+    std::vector<enum_validation> flags_enums;
+};
+
+// Checks the preconditions of a single enum and computes the properties of its value set, throws if the enum is invalid
+enum_validation validate_enum_definition(const enumbra::enum_definition& e, bool is_flags, int64_t size_type_bits);
+
+// Validates every enum of a schema, throws for the first invalid one. Enum names are checked first, then flags enums
+// and value enums. jobs is the number of threads, 0 uses the hardware concurrency.
+schema_validation validate_schema(const enumbra::cpp::cpp_config& cpp_cfg, const enumbra::enum_meta_config& enum_meta, unsigned int jobs = 1);
+
 struct value_enum_context {
     std::string enum_name;
-    std::vector<enumbra::enum_entry> values;
+    enum_entry_span values; // Owned by the enum definition, which outlives the context
 
-    enumbra::enum_entry default_entry;
-    enumbra::enum_entry min_entry;
-    enumbra::enum_entry max_entry;
+    const enumbra::enum_entry* default_entry = nullptr;
+    const enumbra::enum_entry* min_entry = nullptr;
+    const enumbra::enum_entry* max_entry = nullptr;
     int64_t entry_count = 0;
     std::string size_type_str;
     bool is_size_type_signed = false;
@@ -44,6 +85,7 @@ struct value_enum_context {
     int64_t unique_entry_count = 0;
     bool is_range_contiguous = false;
     bool is_one_string_table = false;
+    bool out_of_line = false; // The string tables and string lookups are defined in the generated source file
     std::optional<int128> invalid_sentinel;
 
     string_lookup_tables string_tables;
@@ -55,37 +97,125 @@ struct flags_enum_context {
 
 struct output_context {
     std::vector<size_t> header_guard_positions;
+    std::string include_guard;
 
     std::string enum_ns;
 
-    std::vector<value_enum_context> value_enums;
+    schema_validation validation;
     std::vector<flags_enum_context> flags_enums;
 };
 
+struct cpp_shard_options {
+    std::string base_name = "enumbra_base.hpp"; // Shared header with the macros and base templates
+    std::string umbrella_name; // Header that includes every shard, not generated if empty
+    std::string extension = ".hpp"; // Extension of the per-enum and per-group headers
+};
+
+struct cpp_module_options {
+    std::string module_name; // Dotted module name, e.g. "game.enums"
+    std::string extension = ".cppm"; // Extension of the primary interface unit and the :base partition
+};
+
+struct generated_file {
+    std::string name; // Relative to the output directory
+    std::string content;
+    std::string include_guard;
+    size_t include_guard_position = 0;
+};
+
 class cpp_generator {
 public:
-    cpp_generator(const enumbra::enumbra_config& cfg, const enumbra::enum_meta_config& enum_meta);
+    // jobs is the number of threads used to emit enums, 0 uses the hardware concurrency.
+    // The output is identical for any number of jobs.
+    cpp_generator(const enumbra::enumbra_config& cfg, const enumbra::enum_meta_config& enum_meta, unsigned int jobs = 1);
 
 	const std::string& generate_cpp_output();
 
+    // Streams the output to sink instead of building it in memory, the content is identical to generate_cpp_output().
+    // Only a window of enums is held in memory at a time, the include guard is patched into sink at the end.
+    void generate_cpp_output(output_sink& sink);
+
+    // Sharded output: a base header, one header per enum or group and an optional umbrella header.
+    // Shards include the base header by name, so all files must be written to the same directory.
+    std::vector<generated_file> generate_cpp_shards(const cpp_shard_options& options);
+
+    // Single header output that includes the base header include_name, as written by generate_cpp_base(), instead of
+    // embedding the macros and base templates. Several headers can then share one copy of the base.
+    void set_shared_base(std::string include_name) { shared_base = std::move(include_name); }
+
+    // Base header with the includes, macros and base templates, for sharded output and set_shared_base()
+    generated_file generate_cpp_base(const std::string& name);
+
+    // C++20 module output: the primary interface unit <module_name><extension> exports the enums and imports the
+    // :base partition <module_name>-base<extension>, which exports the base templates. Macros can't be exported,
+    // code that uses the optional macros has to include a header instead. Don't import the module and include a
+    // header generated from the same schema in one translation unit, the enums would be declared twice.
+    std::vector<generated_file> generate_cpp_module(const cpp_module_options& options);
+
+    // Out-of-line output: value enums marked "out_of_line" in the schema only declare to_string and from_string in
+    // the header, their string tables and lookup bodies go to the source file of generate_cpp_source(). Must be set
+    // before generating the header. Enums that aren't marked stay constexpr, the source file is empty for them.
+    void set_out_of_line(bool enabled) { out_of_line = enabled; }
+
+    // Source file defining what the out-of-line enums of the header declare, header_include is the #include path
+    // of the header in the source file. Compile it into exactly one target of the program.
+    generated_file generate_cpp_source(std::string name, const std::string& header_include);
+
+    // Reuse the code of enums whose definition didn't change since they were emitted into cache.
+    // config_fingerprint must change whenever anything in the config changes, e.g. the config file contents.
+    void set_fragment_cache(fragment_cache* cache, std::string_view config_fingerprint);
+
+    // Use the results of validate_schema for the same config and schema instead of validating again, e.g. from a schema image
+    void set_validation(const schema_validation* validation) { precomputed_validation = validation; }
+
+    // Include guard of the generated output and its first position, the guard embeds the FNV-1a hash of the output
+    [[nodiscard]] const std::string& get_include_guard() const { return ctx.include_guard; }
+    [[nodiscard]] size_t get_include_guard_position() const { return ctx.header_guard_positions.front(); }
+
 private:
     const enumbra::cpp::cpp_config& cpp_cfg;
     const enumbra::enum_meta_config& enum_meta;
+    unsigned int jobs = 1;
+    fragment_cache* fragments_cache = nullptr;
+    std::string config_fingerprint;
+    const schema_validation* precomputed_validation = nullptr;
+    std::string shared_base;
+    bool module_unit = false; // Emitting into the purview of a module interface unit
+    bool out_of_line = false; // Enums marked out_of_line only declare their string lookups, see set_out_of_line()
+    bool source_unit = false; // Emitting the definitions of the generated source file
+
+    // Worker for a single enum, writes into its own output and argument store
+    cpp_generator(const enumbra::cpp::cpp_config& cpp_cfg, const enumbra::enum_meta_config& enum_meta, const std::string& enum_ns);
 
     void build_contexts();
+    void validate_enums();
+    void emit_cpp_output();
+    // Fragments of enums [begin, end), indexed value enums first
+    [[nodiscard]] std::vector<std::string> emit_enum_fragments(size_t begin, size_t end);
+    void finalize_include_guard();
+    [[nodiscard]] generated_file emit_base_file(std::string name) const;
+    static generated_file finish_file(cpp_generator& file_gen, std::string name);
+    [[nodiscard]] value_enum_context build_value_enum_context(const enumbra::enum_definition& e, const enum_validation& validation) const;
 
     // Shared
     void emit_preamble();
     void emit_include_guard_begin();
     void emit_include_guard_end();
     void emit_includes();
+    void emit_base_include(const std::string& name);
+    void emit_module_fragment();
     void emit_required_macros();
     void emit_optional_macros();
     void emit_templates();
+    void emit_simd_templates();
 
     // Value enums
+    void emit_value_enum(const value_enum_context& e);
+    void emit_value_enum_source(const value_enum_context& e);
+    void bind_value_enum_args(const value_enum_context& e);
     void emit_ve_definition(const value_enum_context& e);
     void emit_ve_detail(const value_enum_context& e);
+    void emit_ve_string_tables(const value_enum_context& e);
     void emit_ve_func_values(const value_enum_context& e);
     void emit_ve_func_from_integer(const value_enum_context& e);
     void emit_ve_func_is_valid(const value_enum_context& e);
@@ -94,35 +224,29 @@ private:
     void emit_ve_func_from_string_with_size(const value_enum_context& e);
     void emit_ve_func_from_string_cstr(const value_enum_context& e);
 
+    // Flags enums
+    void emit_flags_enum(const enumbra::enum_definition& e, const enum_validation& validation);
+
 private:
     output_context ctx;
-	std::string output; // Final output
+	std::string output; // Final output, or the part that wasn't flushed to sink yet when streaming
 
-    // Argument store
-    std::unordered_map<std::string, std::string> store_map_;
-    fmt::dynamic_format_arg_store<fmt::format_context> store_;
+    // Streaming
+    output_sink* sink = nullptr;
+    size_t flushed_size = 0;
+    fnv1a_64_hash flushed_hash = fnv1a_64_basis; // Hash of the flushed part of the output
 
-    void push(std::string_view key, std::string_view value)
-    {
-        store_map_.insert_or_assign(std::string(key), std::string(value));
-        store_.push_back(fmt::arg(key.data(), value.data()));
-    }
-    void pop(std::string_view key)
-    {
-        auto removed = store_map_.erase(std::string(key));
-        if(removed > 0)
-        {
-            store_.clear();
-            for(auto& kv : store_map_)
-            {
-                store_.push_back(fmt::arg(kv.first.c_str(), kv.second.c_str()));
-            }
-        }
-    }
-    void clear_store() { 
-        store_map_.clear(); 
-        store_.clear(); 
-    }
+    // Offset of the next byte in the whole output
+    [[nodiscard]] size_t output_position() const { return flushed_size + output.size(); }
+    // Moves the output buffer to sink once it is large enough, or always if force is set. No-op without a sink.
+    void flush_output(bool force);
+
+    // Template arguments, bound by slot
+    template_args args_;
+
+    void push(template_slot slot, std::string_view value) { args_.bind(slot, value); }
+    void pop(template_slot slot) { args_.unbind(slot); }
+    void clear_store() { args_.clear(); }
 
     // Write functions
 	template <typename... Args>
@@ -149,9 +273,27 @@ private:
         wlf();
     }
 
-    // write virtual line - using parameter store
-    void wvl(std::string_view fmt) {
-        fmt::vformat_to(std::back_inserter(output), fmt, store_);
+    // write the export keyword in module interface units, before namespaces that declare names for users
+    void wexport() {
+        if (module_unit)
+            output += "export ";
+    }
+
+    // write the constexpr specifier, except for the out-of-line definitions and declarations of e
+    void wconstexpr(const value_enum_context& e) {
+        if (!e.out_of_line)
+            output += "constexpr ";
+    }
+
+    // write the constexpr specifier, or inline for header definitions that call out-of-line functions of e
+    void winline_or_constexpr(const value_enum_context& e) {
+        output += e.out_of_line ? "inline " : "constexpr ";
+    }
+
+    // write virtual line - using the bound template slots
+    // fmt must be a string literal, it is compiled once and cached by address
+    void wvl(const char* fmt) {
+        args_.render(get_compiled_template(fmt), output);
         wlf();
     }
 };
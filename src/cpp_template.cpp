@@ -0,0 +1,114 @@
+#include "cpp_template.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+compiled_template compile_template(std::string_view fmt) {
+    compiled_template t;
+    t.literals.reserve(fmt.size());
+
+    size_t literal_start = 0;
+    const auto flush_literal = [&]() {
+        const size_t length = t.literals.size() - literal_start;
+        if (length > 0) {
+            t.segments.push_back({static_cast<uint32_t>(literal_start), static_cast<uint32_t>(length), compiled_template::literal});
+        }
+        literal_start = t.literals.size();
+    };
+
+    for (size_t i = 0; i < fmt.size(); i++) {
+        const char c = fmt[i];
+        if (c == '{') {
+            if (i + 1 < fmt.size() && fmt[i + 1] == '{') {
+                t.literals += '{';
+                i++;
+                continue;
+            }
+            const size_t close = fmt.find('}', i);
+            if (close == std::string_view::npos) {
+                throw std::logic_error(fmt::format("Unterminated slot in template: {}", fmt));
+            }
+            const std::string_view name = fmt.substr(i + 1, close - i - 1);
+            size_t slot = 0;
+            while (slot < template_slot_count && template_slot_names[slot] != name) {
+                slot++;
+            }
+            if (slot == template_slot_count) {
+                throw std::logic_error(fmt::format("Unknown slot '{}' in template: {}", name, fmt));
+            }
+            flush_literal();
+            t.segments.push_back({0, 0, static_cast<uint8_t>(slot)});
+            i = close;
+        } else if (c == '}') {
+            if (i + 1 < fmt.size() && fmt[i + 1] == '}') {
+                t.literals += '}';
+                i++;
+                continue;
+            }
+            throw std::logic_error(fmt::format("Unmatched '}}' in template: {}", fmt));
+        } else {
+            t.literals += c;
+        }
+    }
+    flush_literal();
+
+    return t;
+}
+
+const compiled_template& get_compiled_template(const char* fmt) {
+    static std::shared_mutex mutex;
+    static std::unordered_map<const char*, std::unique_ptr<compiled_template>> cache;
+
+    {
+        std::shared_lock lock(mutex);
+        auto found = cache.find(fmt);
+        if (found != cache.end()) {
+            return *found->second;
+        }
+    }
+
+    auto compiled = std::make_unique<compiled_template>(compile_template(fmt));
+    std::unique_lock lock(mutex);
+    auto inserted = cache.emplace(fmt, std::move(compiled));
+    return *inserted.first->second;
+}
+
+const std::string& template_args::get(template_slot slot) const {
+    const auto i = static_cast<size_t>(slot);
+    if (!bound_[i]) {
+        throw std::logic_error(fmt::format("Template slot '{}' is not bound", template_slot_names[i]));
+    }
+    return values_[i];
+}
+
+void template_args::render(const compiled_template& t, std::string& out) const {
+    size_t size = 0;
+    for (const auto& s: t.segments) {
+        size += (s.slot == compiled_template::literal) ? s.length : get(static_cast<template_slot>(s.slot)).size();
+    }
+
+    const size_t start = out.size();
+    if (out.capacity() < start + size) {
+        out.reserve(std::max(start + size, out.capacity() * 2));
+    }
+    out.resize(start + size);
+
+    char* dst = out.data() + start;
+    for (const auto& s: t.segments) {
+        if (s.slot == compiled_template::literal) {
+            std::memcpy(dst, t.literals.data() + s.offset, s.length);
+            dst += s.length;
+        } else {
+            const std::string& value = values_[s.slot];
+            std::memcpy(dst, value.data(), value.size());
+            dst += value.size();
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Named values that emission templates can reference, e.g. "enum class {enum_name} : {size_type}"
+// Slots are bound by index, the names are only used when a template is compiled.
+enum class template_slot : uint8_t {
+    enum_ns,
+    enum_ns_size,
+    enum_name,
+    enum_name_size,
+    enum_detail_ns,
+    enum_name_fq,
+    enum_name_fq_size,
+    enum_name_fq_no_global,
+    enum_name_fq_no_global_size,
+    size_type,
+    entry_count,
+    unique_entry_count,
+    entry_name,
+    entry_name_len,
+    min_v,
+    max_v,
+    max_value,
+    lowest_flag,
+    lowest_bit,
+    max_to_string_size,
+    simd_backend,
+
+    COUNT
+};
+
+constexpr size_t template_slot_count = static_cast<size_t>(template_slot::COUNT);
+
+constexpr std::array<std::string_view, template_slot_count> template_slot_names = {
+    "enum_ns",
+    "enum_ns_size",
+    "enum_name",
+    "enum_name_size",
+    "enum_detail_ns",
+    "enum_name_fq",
+    "enum_name_fq_size",
+    "enum_name_fq_no_global",
+    "enum_name_fq_no_global_size",
+    "size_type",
+    "entry_count",
+    "unique_entry_count",
+    "entry_name",
+    "entry_name_len",
+    "min_v",
+    "max_v",
+    "max_value",
+    "lowest_flag",
+    "lowest_bit",
+    "max_to_string_size",
+    "simd_backend",
+};
+
+// A template parsed into literal and slot segments.
+// Uses the same syntax as fmt named arguments: {name} is a slot, {{ and }} are literal braces.
+struct compiled_template {
+    struct segment {
+        uint32_t offset = 0; // Into literals, unused for slots
+        uint32_t length = 0;
+        uint8_t slot = 0xFF; // 0xFF for literal text
+    };
+
+    static constexpr uint8_t literal = 0xFF;
+
+    std::string literals; // Unescaped literal text of all segments
+    std::vector<segment> segments;
+};
+
+// Parses a template, throws std::logic_error on an unknown slot name or unbalanced braces.
+compiled_template compile_template(std::string_view fmt);
+
+// Returns the compiled form of a template string with static storage duration (a string literal).
+// Templates are compiled on first use and cached by address for the lifetime of the program. Thread-safe.
+const compiled_template& get_compiled_template(const char* fmt);
+
+// Values bound to template slots
+class template_args {
+public:
+    void bind(template_slot slot, std::string_view value) {
+        const auto i = static_cast<size_t>(slot);
+        values_[i].assign(value.data(), value.size());
+        bound_[i] = true;
+    }
+    void unbind(template_slot slot) { bound_[static_cast<size_t>(slot)] = false; }
+    void clear() { bound_.fill(false); }
+
+    // Throws std::logic_error if the slot is not bound
+    [[nodiscard]] const std::string& get(template_slot slot) const;
+
+    // Appends the rendered template to out
+    void render(const compiled_template& t, std::string& out) const;
+
+private:
+    std::array<std::string, template_slot_count> values_;
+    std::array<bool, template_slot_count> bound_{};
+};
@@ -1,5 +1,11 @@
 #include "cpp_utility.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
 
 std::string format_int128(Int128Format c) {
     if (c.bIsSigned) {
@@ -41,6 +47,20 @@ bool is_valid_macro_name(const std::string& str)
     return true;
 }
 
+bool is_valid_module_name(const std::string& str)
+{
+    size_t begin = 0;
+    while (begin <= str.size()) {
+        const size_t end = std::min(str.find('.', begin), str.size());
+        const std::string part = str.substr(begin, end - begin);
+        if (part.empty() || (part[0] >= '0' && part[0] <= '9') || !is_valid_macro_name(part)) {
+            return false;
+        }
+        begin = end + 1;
+    }
+    return true;
+}
+
 std::string to_upper_ascii(const std::string &str) {
     // Note: This previously used std::toupper, but calling that on Windows 
     // causes some locale initialization that takes 10ms! We only care about
@@ -54,3 +74,50 @@ std::string to_upper_ascii(const std::string &str) {
     return copy;
 }
 
+void run_parallel(size_t count, unsigned int jobs, const std::function<void(size_t)> &task) {
+    if (jobs == 0) {
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const size_t thread_count = std::min<size_t>(jobs, count);
+    if (thread_count <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next_index{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::exception_ptr> errors(count);
+
+    const auto worker = [&]() {
+        while (!failed.load(std::memory_order_relaxed)) {
+            const size_t i = next_index.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count) {
+                return;
+            }
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    for (size_t t = 1; t < thread_count; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t: threads) {
+        t.join();
+    }
+
+    for (auto &e: errors) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
@@ -4,6 +4,8 @@
 
 #include <fmt/format.h>
 
+#include <functional>
+
 struct Int128Format {
 	int128 value;
 	int64_t bits;
@@ -54,9 +56,17 @@ struct fmt::formatter<Int128Format> {
 // We limit to a-z, A-Z, 0-9, and underscore.
 bool is_valid_macro_name(const std::string& str);
 
+// Returns true if str can be used as a module name: identifiers of a-z, A-Z, 0-9 and underscore separated by dots.
+bool is_valid_module_name(const std::string& str);
+
 // Uppercase ascii string
 std::string to_upper_ascii(const std::string& str);
 
+// Runs task(0..count-1) on up to `jobs` threads, 0 uses the hardware concurrency.
+// Indices are claimed in increasing order, so when tasks throw, every lower index has already run and the
+// rethrown exception is always the one from the lowest failing index, same as a serial loop.
+void run_parallel(size_t count, unsigned int jobs, const std::function<void(size_t)>& task);
+
 // Log2 of unsigned int
 constexpr int64_t log_2_unsigned(uint128 x) {
 	if (x == 0) {
@@ -86,11 +96,11 @@ constexpr int64_t get_transmission_bits_required(uint128 x) {
 
 // FNV-1a Hash - 64 bit
 using fnv1a_64_hash = uint64_t;
-constexpr fnv1a_64_hash fnv1a_64(const std::string_view str) noexcept {
-	constexpr fnv1a_64_hash fnv1_basis_64 = 0xcbf29ce484222325ULL;
-	constexpr fnv1a_64_hash fnv1_prime_64 = 0x00000100000001b3ULL;
+constexpr fnv1a_64_hash fnv1a_64_basis = 0xcbf29ce484222325ULL;
 
-	fnv1a_64_hash hash = fnv1_basis_64;
+// Continues fnv1a_64 over more data: fnv1a_64(a + b) == fnv1a_64_update(fnv1a_64(a), b)
+constexpr fnv1a_64_hash fnv1a_64_update(fnv1a_64_hash hash, const std::string_view str) noexcept {
+	constexpr fnv1a_64_hash fnv1_prime_64 = 0x00000100000001b3ULL;
 
 	for (const char c : str)
 	{
@@ -99,3 +109,25 @@ constexpr fnv1a_64_hash fnv1a_64(const std::string_view str) noexcept {
 
 	return hash;
 }
+
+constexpr fnv1a_64_hash fnv1a_64(const std::string_view str) noexcept {
+	return fnv1a_64_update(fnv1a_64_basis, str);
+}
+
+// Continues an FNV-1a hash with a field, the length is hashed first so adjacent fields can't run into each other
+constexpr fnv1a_64_hash fnv1a_64_append(fnv1a_64_hash hash, const std::string_view field) noexcept {
+	constexpr fnv1a_64_hash fnv1_prime_64 = 0x00000100000001b3ULL;
+
+	uint64_t length = field.size();
+	for (int i = 0; i < 8; i++)
+	{
+		hash = (hash ^ (length & 0xFF)) * fnv1_prime_64;
+		length >>= 8;
+	}
+	for (const char c : field)
+	{
+		hash = (hash ^ static_cast<unsigned char>(c)) * fnv1_prime_64;
+	}
+
+	return hash;
+}
@@ -2,39 +2,24 @@
 //
 
 #include "enumbra.h"
+#include <chrono>
 #include <cstdio>
 #include <filesystem>
-#include <charconv>
 #include <fstream>
+#include <optional>
 #include <cxxopts.hpp>
 #include <absl/strings/strip.h>
+#include "config_loader.h"
 #include "cpp_generator.h"
 #include "cpp_parser.h"
-
-namespace {
-    bool contains_whitespace(const std::string_view str)
-    {
-        for(auto& s : str) {
-            if(std::isspace(s)) {
-                return true;
-            }
-        }
-        return false;
-    }
-}
+#include "generation_cache.h"
+#include "generation_job.h"
+#include "output_file.h"
+#include "profiler.h"
+#include "watch_mode.h"
 
 using namespace enumbra;
 
-enumbra::enumbra_config load_enumbra_config(const std::string &config_file);
-
-enumbra::enum_meta_config load_meta_config(enumbra::enumbra_config &enumbra_config, const std::string &config_file);
-
-void parse_enumbra_cpp(enumbra::enumbra_config &enumbra_config, json &cpp_cfg);
-
-void parse_enumbra_csharp(enumbra::enumbra_config &enumbra_config, json &csharp_cfg);
-
-void parse_enum_meta(enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config);
-
 void print_help(const cxxopts::Options &options) {
     printf("%s\n", options.help().c_str());
 }
@@ -49,18 +34,33 @@ int main(int argc, char **argv) {
     }*/
 
     try {
-        auto start = std::chrono::system_clock::now();
+        const auto start = std::chrono::steady_clock::now();
 
         cxxopts::Options options("enumbra", "An enum code generator. https://github.com/Scaless/enumbra");
         options
-            .custom_help("-c enumbra_config.json -s enum.json")
+            .custom_help("-c enumbra_config.json -s enum.json --cppout enum.hpp [-s enum2.json --cppout enum2.hpp ...]")
             .add_options()
                 ("h,help", "You are here.")
                 ("c,config", "[Required] Path to enumbra config file (enumbra_config.json).", cxxopts::value<std::string>())
-                ("s,source", "[Required] Path to enum config file (enum.json).", cxxopts::value<std::string>())
-                ("cppout", "[Required] Path to output C++ header file.", cxxopts::value<std::string>())
+                ("s,source", "[Required] Path to enum config file (enum.json). Can be repeated, each source is paired with the --cppout or --cppout-dir at the same position.", cxxopts::value<std::vector<std::string>>())
+                ("cppout", "[Required] Path to output C++ header file.", cxxopts::value<std::vector<std::string>>())
+                ("cppout-dir", "Sharded output, replaces --cppout. Writes a base header, one header per enum (or per group) and an optional umbrella header to this directory.", cxxopts::value<std::vector<std::string>>())
+                ("base-header", "Name of the shared base header for sharded output.", cxxopts::value<std::string>()->default_value("enumbra_base.hpp"))
+                ("shared-base", "Write the includes, macros and base templates once to this header and include it from every --cppout header instead of embedding them.", cxxopts::value<std::string>())
+                ("umbrella", "Name of a header that includes every shard, for sharded output.", cxxopts::value<std::string>())
+                ("cppsrc", "Also generate this C++ source file with the string tables and string lookups of the value enums marked \"out_of_line\" in the schema, the header then only declares them. Requires a single --cppout.", cxxopts::value<std::string>())
+                ("module", "Also generate a C++20 module of this name: <name>.cppm exporting the enums and the partition <name>-base.cppm exporting the base templates, next to the header or into the --cppout-dir directory.", cxxopts::value<std::string>())
+                ("manifest", "Path to a JSON manifest of schemas to generate, replaces -s and --cppout. The config is loaded once and schemas are generated in parallel.", cxxopts::value<std::string>())
+                ("cache-dir", "Directory of previously generated outputs and compiled schemas, reused when the config, schema and options are unchanged. Can be shared by parallel builds. The least recently used entries are removed once it grows past --cache-max-size.", cxxopts::value<std::string>())
+                ("cache-max-size", "Size limit of the --cache-dir directory in MB, 0 for no limit. The outputs and the per-enum fragments are limited separately.", cxxopts::value<uint64_t>()->default_value("1024"))
+                ("j,jobs", "Number of threads used to generate enums, 0 uses all hardware threads. Output is identical for any value.", cxxopts::value<unsigned int>()->default_value("0"))
+                ("depfile", "Write a Make/Ninja dependency file listing the config, manifest and schema each output was generated from.", cxxopts::value<std::string>())
+                ("stamp", "Touch this file after generating, and make it the target of the --depfile instead of the outputs. For build tools that would otherwise rerun enumbra while unchanged outputs keep their old timestamps.", cxxopts::value<std::string>())
+                ("watch", "Keep running and regenerate outputs when the config or a schema changes. Regenerations can also be requested on stdin, see watch_mode.h for the protocol.")
                 ("version", "Prints version information.")
                 ("showtime", "Print out total time taken to generate")
+                ("profile", "Print the time, allocations and peak memory use of each generation phase and of the slowest enums.")
+                ("profile-trace", "Write the profile as Chrome trace event JSON to this file, viewable in chrome://tracing or Perfetto. Implies --profile.", cxxopts::value<std::string>())
                 ("p,print", "Prints output to the console.");
 
         auto result = options.parse(argc, argv);
@@ -73,376 +73,159 @@ int main(int argc, char **argv) {
             print_version();
             return 0;
         }
-        if (!result.count("c")) {
-            throw std::logic_error("Enumbra Config File (-c|--config) argument is required.");
-        }
-        if (!result.count("s")) {
-            throw std::logic_error("Enum Source File (-s|--source) argument is required.");
-        }
-        if (!result.count("cppout")) {
-            throw std::logic_error("C++ Output File Path (--cppout) argument is required.");
-        }
-
-        auto config_file_path = result["c"].as<std::string>();
-        auto source_file_path = result["s"].as<std::string>();
-        auto cppout_file_path = result["cppout"].as<std::string>();
-
-        if (!std::filesystem::exists(config_file_path)) {
-            throw std::logic_error("Config file does not exist.");
-        }
-        if (!std::filesystem::exists(source_file_path)) {
-            throw std::logic_error("Source file does not exist.");
-        }
-
-        auto loaded_enumbra_config = load_enumbra_config(config_file_path);
-        auto enum_config = load_meta_config(loaded_enumbra_config, source_file_path);
 
-        if (loaded_enumbra_config.generate_cpp) {
-            cpp_generator cpp_gen(loaded_enumbra_config, enum_config);
-            const std::string &generated_cpp = cpp_gen.generate_cpp_output();
-
-            if (result.count("p")) {
-                printf("%s\n", generated_cpp.c_str());
+        std::string config_file_path;
+        std::vector<generation_job> jobs;
+        std::vector<std::string> depfile_inputs;
+        std::string shared_base;
+        if (result.count("manifest")) {
+            if (result.count("s") || result.count("cppout") || result.count("cppout-dir") || result.count("module") || result.count("cppsrc")) {
+                throw std::logic_error("--manifest can't be combined with -s, --cppout, --cppout-dir, --module or --cppsrc.");
             }
-            std::ofstream file(cppout_file_path);
-            file << generated_cpp;
-
-            if (result.count("showtime")) {
-                auto end = std::chrono::system_clock::now();
-                auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-                printf("The cpp file was successfully output in (%s ms) to: %s\n", std::to_string(elapsed.count()).c_str(), cppout_file_path.c_str());
+            auto manifest = load_generation_manifest(result["manifest"].as<std::string>());
+            depfile_inputs.push_back(result["manifest"].as<std::string>());
+            config_file_path = std::move(manifest.config);
+            shared_base = std::move(manifest.shared_base);
+            jobs = std::move(manifest.jobs);
+        } else {
+            if (!result.count("s")) {
+                throw std::logic_error("Enum Source File (-s|--source) argument is required.");
+            }
+            if (!result.count("cppout") && !result.count("cppout-dir")) {
+                throw std::logic_error("C++ Output File Path (--cppout) argument is required.");
+            }
+            if (result.count("cppout") && result.count("cppout-dir")) {
+                throw std::logic_error("Only one of --cppout and --cppout-dir can be used, use --manifest to mix them.");
             }
-        }
-        if (loaded_enumbra_config.generate_csharp) {
-            // TODO
-        }
-    }
-    catch (const std::exception &e) {
-        // TODO: print a better stacktrace
-        printf("%s\n", e.what());
-        return -1;
-    }
-
-    return 0;
-}
-
-
-enumbra::enumbra_config load_enumbra_config(const std::string &config_file) {
-    enumbra::enumbra_config cfg;
-
-    std::ifstream file(config_file);
-    json data = json::parse(file, nullptr, true, true);
-
-    auto configuration = data["enumbra_config"];
-    auto cpp_config = configuration["cpp_generator"];
-    auto csharp_config = configuration["csharp_generator"];
-
-    if (cpp_config.is_object()) {
-        parse_enumbra_cpp(cfg, cpp_config);
-    }
-    if (csharp_config.is_object()) {
-        parse_enumbra_csharp(cfg, csharp_config);
-    }
-
-    return cfg;
-}
-
-enumbra::enum_meta_config load_meta_config(enumbra::enumbra_config &enumbra_config, const std::string &config_file) {
-    enumbra::enum_meta_config cfg;
-
-    std::ifstream file(config_file);
-    json data = json::parse(file, nullptr, true, true);
-
-    auto enum_meta = data["enums"];
-
-    parse_enum_meta(enumbra_config, cfg, enum_meta);
-
-    return cfg;
-}
-
-void parse_enumbra_cpp(enumbra::enumbra_config &enumbra_config, json &cpp_cfg) {
-    using namespace enumbra::cpp;
-    try {
-        cpp_config &c = enumbra_config.cpp_config;
-
-        c.output_namespace = get_array<std::string>(cpp_cfg["output_namespace"]);
-        c.time_generated_in_header = cpp_cfg["time_generated_in_header"].get<bool>();
-        c.preamble_text = get_array<std::string>(cpp_cfg["preamble_text"]);
-        c.additional_includes = get_array<std::string>(cpp_cfg["additional_includes"]);
-
-        for (auto iter: cpp_cfg["size_types"]) {
-            enum_size_type t;
-            t.name = iter["name"].get<std::string>();
-            t.bits = iter["bits"].get<int32_t>();
-            t.is_signed = iter["is_signed"].get<bool>();
-            t.type_name = iter["type_name"].get<std::string>();
 
-            if (t.name.empty()) {
-                throw std::logic_error("size type name cannot be empty");
+            const bool sharded = result.count("cppout-dir") > 0;
+            const auto sources = result["s"].as<std::vector<std::string>>();
+            const auto outputs = result[sharded ? "cppout-dir" : "cppout"].as<std::vector<std::string>>();
+            if (sources.size() != outputs.size()) {
+                throw std::logic_error("Each source (-s) requires a matching output (--cppout or --cppout-dir).");
             }
-            if (t.bits > 64) {
-                throw std::logic_error("size type bits cannot be greater than 64");
+            if (result.count("module") && sources.size() > 1) {
+                throw std::logic_error("--module names the module of a single source, use --manifest to generate modules for several.");
             }
-            if (t.type_name.empty()) {
-                throw std::logic_error("size type type_name cannot be empty");
+            if (result.count("cppsrc") && (sharded || sources.size() > 1)) {
+                throw std::logic_error("--cppsrc requires a single source and --cppout, use --manifest to generate source files for several.");
             }
 
-            if (t.is_signed) {
-                // To get the maximum, we fill all bits except the sign bit
-                t.max_possible_value = 0;
-                for (int32_t i = 0; i < t.bits - 1; i++) {
-                    t.max_possible_value |= (int128(1) << static_cast<int>(i));
+            for (size_t i = 0; i < sources.size(); i++) {
+                generation_job job;
+                job.source = sources[i];
+                job.cppout = outputs[i];
+                job.sharded = sharded;
+                job.shard_options.base_name = result["base-header"].as<std::string>();
+                if (result.count("umbrella")) {
+                    job.shard_options.umbrella_name = result["umbrella"].as<std::string>();
                 }
-
-                // Minimum is found by inverting the max value, then subtract 1
-                t.min_possible_value = -t.max_possible_value - 1;
-            } else {
-                // To get the maximum, we fill all bits
-                t.max_possible_value = 0;
-                for (int32_t i = 0; i < t.bits; i++) {
-                    t.max_possible_value |= (int128(1) << static_cast<int>(i));
+                if (result.count("module")) {
+                    job.module_name = result["module"].as<std::string>();
                 }
-
-                // Minimum always 0
-                t.min_possible_value = 0;
+                if (result.count("cppsrc")) {
+                    job.cppsrc = result["cppsrc"].as<std::string>();
+                }
+                jobs.push_back(std::move(job));
             }
-
-            c.size_types.push_back(t);
         }
-        if (c.size_types.empty()) {
-            throw std::logic_error("size_types array is required. See the enumbra documentation for details.");
+        if (result.count("c")) {
+            config_file_path = result["c"].as<std::string>();
         }
-
-        std::string default_value_enum_size_type = cpp_cfg["default_value_enum_size_type"].get<std::string>();
-        c.default_value_enum_size_type_index = c.get_size_type_index_from_name(default_value_enum_size_type);
-        if (c.default_value_enum_size_type_index == SIZE_MAX) {
-            throw std::logic_error("default_value_enum_size_type must reference an existing size_type.");
+        if (result.count("shared-base")) {
+            shared_base = result["shared-base"].as<std::string>();
         }
-
-        std::string default_flags_enum_size_type = cpp_cfg["default_flags_enum_size_type"].get<std::string>();
-        c.default_flags_enum_size_type_index = c.get_size_type_index_from_name(default_flags_enum_size_type);
-        if (c.default_flags_enum_size_type_index == SIZE_MAX) {
-            throw std::logic_error("default_flags_enum_size_type must reference an existing size_type.");
+        if (config_file_path.empty()) {
+            throw std::logic_error("Enumbra Config File (-c|--config) argument is required.");
         }
 
-        c.string_table_layout = get_mapped<StringTableLayout>(StringTableLayoutMapped, cpp_cfg["string_table_layout"]);
-
-        c.min_max_functions = cpp_cfg["min_max_functions"].get<bool>();
-        c.bit_info_functions = cpp_cfg["bit_info_functions"].get<bool>();
-        c.enumbra_bitfield_macros = cpp_cfg["enumbra_bitfield_macros"].get<bool>();
-    }
-    catch (const std::exception &e) {
-
-        std::string x = std::string("parse_enumbra_cpp_config: ") + e.what();
-        throw std::logic_error(x.c_str());
-    }
-}
-
-void parse_enumbra_csharp(enumbra::enumbra_config & /*enumbra_config*/, json & /*csharp_cfg*/) {
-    throw std::logic_error("parse_enumbra_csharp not implemented.");
-}
-
-bool is_pow_2(int128 x) {
-    return x && !(x & (x - 1));
-}
-
-int128 string_to_int128(const std::string_view s) {
-    const bool bIsHexString = (s.size() >= 2) && (s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X'));
-    const bool bIsBinaryString = (s.size() >= 2) && (s[0] == '0') && ((s[1] == 'b'));
-    if (bIsHexString) {
-        // Unsigned Hex
-        uint64_t unsigned_value;
-        auto result = std::from_chars(s.data() + 2, s.data() + s.size(), unsigned_value, 16);
-        const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
-        if (bConsumedEntireString && result.ec == std::errc{}) {
-            return int128(unsigned_value);
-        }
-    } else if (bIsBinaryString) {
-        // Unsigned Binary
-        uint64_t unsigned_value;
-        auto result = std::from_chars(s.data() + 2, s.data() + s.size(), unsigned_value, 2);
-        const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
-        if (bConsumedEntireString && result.ec == std::errc{}) {
-            return int128(unsigned_value);
+        if (!std::filesystem::exists(config_file_path)) {
+            throw std::logic_error("Config file does not exist.");
         }
-    } else {
-        // Signed Base 10
-        {
-            int64_t signed_value;
-            auto result = std::from_chars(s.data(), s.data() + s.size(), signed_value);
-            const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
-            if (bConsumedEntireString && result.ec == std::errc{}) {
-                return int128(signed_value);
+        for (const auto &job: jobs) {
+            if (!std::filesystem::exists(job.source)) {
+                throw std::logic_error("Source file does not exist: " + job.source);
             }
         }
 
-        // Unsigned Base 10
-        {
-            uint64_t unsigned_value;
-            auto result = std::from_chars(s.data(), s.data() + s.size(), unsigned_value);
-            const bool bConsumedEntireString = result.ptr == (s.data() + s.size());
-            if (bConsumedEntireString && result.ec == std::errc{}) {
-                return int128(unsigned_value);
-            }
+        generation_options gen_options;
+        gen_options.jobs = result["jobs"].as<unsigned int>();
+        gen_options.print = result.count("p") > 0;
+        if (result.count("cache-dir")) {
+            gen_options.cache_dir = result["cache-dir"].as<std::string>();
+            gen_options.cache_max_bytes = result["cache-max-size"].as<uint64_t>() * 1024 * 1024;
         }
-    }
-
-    throw std::invalid_argument(fmt::format("\"{0}\" could not be parsed to an integer.", s));
-}
-
-// Throws if v will not be storable in the defined size_type
-void validate_value_fits_in_size_type(const enumbra::cpp::enum_size_type &size_type, const int128 v) {
-    if ((v < size_type.min_possible_value) || (v > size_type.max_possible_value)) {
-        auto to_string_128 = [](int128 v) -> std::string {
-            return (v < 0) ? fmt::format("{0}", static_cast<int64_t>(v)) : fmt::format("{0}", static_cast<uint64_t>(v));
-        };
-        auto to_string_128_hex = [](int128 v) -> std::string {
-            return (v < 0) ? fmt::format("{0:#x}", static_cast<int64_t>(v)) : fmt::format("{0:#x}",
-                                                                                          static_cast<uint64_t>(v));
-        };
-        throw std::logic_error(fmt::format("entry_value {0} ({1}) is out of the possible range {2} to {3}",
-                                           to_string_128(v),
-                                           to_string_128_hex(v),
-                                           to_string_128(size_type.min_possible_value),
-                                           to_string_128(size_type.max_possible_value)
-        ));
-    }
-}
-
-void
-parse_enum_meta(enumbra::enumbra_config &enumbra_config, enumbra::enum_meta_config &enum_config, json &meta_config) {
-
-    enum_config.value_enum_default_value_style = get_mapped<ValueEnumDefaultValueStyle>(
-            ValueEnumDefaultValueStyleMapped, meta_config["value_enum_default_value_style"]);
-    enum_config.flags_enum_default_value_style = get_mapped<FlagsEnumDefaultValueStyle>(
-            FlagsEnumDefaultValueStyleMapped, meta_config["flags_enum_default_value_style"]);
-
-    for (auto &value_enum: meta_config["value_enums"]) {
-        enum_definition def;
-        def.name = value_enum["name"].get<std::string>();
-
-        std::string size_type_string = value_enum.value("size_type", "");
-        if (!size_type_string.empty()) {
-            def.size_type_index = enumbra_config.cpp_config.get_size_type_index_from_name(size_type_string);
-            if (def.size_type_index == SIZE_MAX) {
-                throw std::logic_error(
-                        "value_enum size_type does not exist in global types table: " + size_type_string);
+        if (!shared_base.empty()) {
+            gen_options.shared_base = shared_base;
+            for (auto &job: jobs) {
+                if (!job.sharded) {
+                    job.shared_base = shared_base_include_path(shared_base, job.cppout);
+                }
             }
-        } else {
-            // use the default size_type
-            def.size_type_index = enumbra_config.cpp_config.default_value_enum_size_type_index;
         }
 
-        def.default_value_name = value_enum.value("default_value", "");
-
-        int128 current_value = 0;
-        for (auto &entry: value_enum["entries"]) {
-            enum_entry ee;
-            ee.name = entry["name"].get<std::string>();
-            ee.description = entry.value("description", "");
-
-            if(ee.name.empty()) {
-                throw std::logic_error("enum value name is empty");
-            }
-            if(contains_whitespace((ee.name))) {
-                throw std::logic_error("enum value name contains whitespace character");
-            }
-
-            auto entry_value = entry["value"];
-            if (entry_value.is_null()) {
-                ee.p_value = current_value;
-            } else if (entry_value.is_string()) {
-                ee.p_value = string_to_int128(entry_value.get<std::string>());
-            } else if (entry_value.is_number_unsigned()) {
-                ee.p_value = entry_value.get<uint64_t>();
-            } else if (entry_value.is_number_integer()) {
-                ee.p_value = entry_value.get<int64_t>();
-            } else {
-                throw std::logic_error("entry_value type is not valid");
+        const bool profiling = result.count("profile") || result.count("profile-trace");
+        if (result.count("watch")) {
+            if (profiling || result.count("depfile") || result.count("stamp")) {
+                throw std::logic_error("--profile, --profile-trace, --depfile and --stamp can't be combined with --watch.");
             }
-
-            auto size_type = enumbra_config.cpp_config.get_size_type_from_index(def.size_type_index);
-            validate_value_fits_in_size_type(size_type, ee.p_value);
-
-            current_value = ee.p_value + 1;
-            def.values.push_back(ee);
+            return run_watch(config_file_path, jobs, gen_options);
         }
 
-        std::sort(def.values.begin(), def.values.end(),
-                  [](const enum_entry &a, const enum_entry &b) { return a.p_value < b.p_value; }
-        );
-
-        enum_config.value_enum_definitions.push_back(def);
-    }
+        std::optional<profiler> profile;
+        if (profiling) {
+            profile.emplace();
+            set_active_profiler(&*profile);
+        }
 
+        // The config is loaded once for all jobs
+        const std::string config_bytes = read_file_bytes(config_file_path);
+        const auto loaded_enumbra_config = load_enumbra_config(config_file_path);
+        const auto results = run_generation_jobs(loaded_enumbra_config, config_bytes, jobs, gen_options);
 
-    for (auto &flags_enum: meta_config["flags_enums"]) {
-        enum_definition def;
-        def.name = flags_enum["name"].get<std::string>();
-        std::string size_type_string = flags_enum.value("size_type", "");
-        if (!size_type_string.empty()) {
-            def.size_type_index = enumbra_config.cpp_config.get_size_type_index_from_name(size_type_string);
-            if (def.size_type_index == SIZE_MAX) {
-                throw std::logic_error(
-                        "flags_enum size_type does not exist in global types table: " + size_type_string);
-            }
-        } else {
-            // use the default size_type
-            def.size_type_index = enumbra_config.cpp_config.default_flags_enum_size_type_index;
+        const std::string stamp = result.count("stamp") ? result["stamp"].as<std::string>() : "";
+        if (result.count("depfile")) {
+            depfile_inputs.insert(depfile_inputs.begin(), config_file_path);
+            write_file_atomic(result["depfile"].as<std::string>(), make_depfile(depfile_inputs, jobs, results, stamp));
+        }
+        if (!stamp.empty()) {
+            write_file_atomic(stamp, "");
         }
-        def.default_value_name = flags_enum.value("default_value", "");
-
-        int64_t current_shift = 0;
-        for (auto &entry: flags_enum["entries"]) {
-            enum_entry ee;
-            ee.name = entry["name"].get<std::string>();
-            ee.description = entry.value("description", "");
 
-            auto entry_value = entry["value"];
-            if (entry_value.is_null()) {
-                ee.p_value = 1LL << current_shift;
-            } else if (entry_value.is_string()) {
-                ee.p_value = string_to_int128(entry_value.get<std::string>());
-            } else if (entry_value.is_number_unsigned()) {
-                ee.p_value = entry_value.get<uint64_t>();
-            } else if (entry_value.is_number_integer()) {
-                ee.p_value = entry_value.get<int64_t>();
-            } else {
-                throw std::logic_error("entry_value type is not valid");
+        if (profile) {
+            set_active_profiler(nullptr);
+            printf("%s", profile->report().c_str());
+            if (result.count("profile-trace")) {
+                const std::string trace_file = result["profile-trace"].as<std::string>();
+                std::ofstream trace(trace_file, std::ios::binary);
+                trace << profile->trace_events().dump();
+                if (!trace) {
+                    throw std::runtime_error("Failed to write profile trace: " + trace_file);
+                }
             }
+        }
 
-            auto &size_type = enumbra_config.cpp_config.get_size_type_from_index(def.size_type_index);
-            validate_value_fits_in_size_type(size_type, ee.p_value);
-
-            if (!is_pow_2(ee.p_value)) {
-                throw std::logic_error(
-                        "flags_enum value is not a power of 2 (1 bit set). Non-pow2 values are not currently supported.");
-            }
-            current_shift++;
-            while ((1LL << current_shift) < ee.p_value) {
-                current_shift++;
+        if (result.count("showtime")) {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            for (size_t i = 0; i < jobs.size(); i++) {
+                const auto &job = jobs[i];
+                const auto &r = results[i];
+                if (job.sharded) {
+                    printf("%zu of %zu cpp files were output to: %s\n", r.files_written, r.files_total, job.cppout.c_str());
+                } else if (r.files_written > 0) {
+                    printf("The cpp file was successfully output to: %s\n", job.cppout.c_str());
+                } else {
+                    printf("The cpp file is up to date: %s\n", job.cppout.c_str());
+                }
             }
-            def.values.push_back(ee);
+            printf("Generated %zu schemas in (%.3f ms)\n", jobs.size(), std::chrono::duration<double, std::milli>(elapsed).count());
         }
-
-        std::sort(def.values.begin(), def.values.end(),
-                  [](const enum_entry &a, const enum_entry &b) { return a.p_value < b.p_value; }
-        );
-
-        enum_config.flag_enum_definitions.push_back(def);
     }
-}
-
-size_t enumbra::cpp::cpp_config::get_size_type_index_from_name(std::string_view name) {
-    for (size_t i = 0; i < size_types.size(); i++) {
-        if (size_types[i].name == name) {
-            return i;
-        }
+    catch (const std::exception &e) {
+        // TODO: print a better stacktrace
+        printf("%s\n", e.what());
+        return -1;
     }
-    return SIZE_MAX;
-}
 
-const enumbra::cpp::enum_size_type &enumbra::cpp::cpp_config::get_size_type_from_index(size_t index) const {
-    // Will throw if index out of bounds
-    return size_types.at(index);
+    return 0;
 }
@@ -68,12 +68,13 @@ namespace enumbra {
 			size_t default_flags_enum_size_type_index{ SIZE_MAX };
 
 			StringTableLayout string_table_layout{ StringTableLayout::NameAndDescription };
+			SIMDCodeGen simd_codegen{ SIMDCodeGen::Scalar64 };
 
 			bool min_max_functions{ true };
 			bool bit_info_functions{ true };
 			bool enumbra_bitfield_macros{ true };
 
-			size_t get_size_type_index_from_name(std::string_view name);
+			[[nodiscard]] size_t get_size_type_index_from_name(std::string_view name) const;
 			[[nodiscard]] const enum_size_type& get_size_type_from_index(size_t index) const;
 		};
 	}
@@ -121,11 +122,39 @@ namespace enumbra {
         return (lhs.name == rhs.name) && (lhs.description == rhs.description) && (lhs.p_value == rhs.p_value);
     }
 
+	// A flag that requires or implies a set of other flags
+	struct flags_relation
+	{
+		std::string flag;
+		std::vector<std::string> targets;
+	};
+
+	// Flags-Enum invariants declared in the schema, entries are referenced by name
+	struct flags_constraints
+	{
+		std::vector<std::vector<std::string>> exclusive; // At most one flag of each group may be set
+		std::vector<std::vector<std::string>> exactly_one; // Exactly one flag of each group must be set
+		std::vector<flags_relation> requirements; // If flag is set, all targets must be set
+		std::vector<flags_relation> implications; // Same as requirements, and closure() sets the targets
+	};
+
+	// A named combination of flags
+	struct flags_preset
+	{
+		std::string name;
+		std::vector<std::string> flags;
+	};
+
 	struct enum_definition
 	{
 		std::string name;
 		std::vector<enum_entry> values;
 		std::string default_value_name;
+		flags_constraints constraints;
+		std::vector<flags_preset> presets;
+		bool to_string_presets{ false }; // to_string prefers preset names over individual flags
+		std::string group; // Enums in the same group share a header in sharded output, empty for a header per enum
+		bool out_of_line{ false }; // Value enums: string tables and string lookups are defined in the generated source file, if there is one
 
 		size_t size_type_index{ SIZE_MAX };
 	};
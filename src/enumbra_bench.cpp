@@ -0,0 +1,274 @@
+// enumbra_bench.cpp : Generates synthetic schemas and measures generator throughput.
+//
+
+#include "enumbra.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <cxxopts.hpp>
+#include "allocation_counter.h"
+#include "config_loader.h"
+#include "cpp_generator.h"
+
+namespace {
+    struct bench_options {
+        int value_enums = 100;
+        int flags_enums = 100;
+        int entries = 50; // Entries per value enum
+        int name_min = 4; // Entry name length distribution, uniform in [name_min, name_max]
+        int name_max = 24;
+        double sparsity = 0.0; // Chance that a value or flag bit is skipped
+        int flags_bits = 32; // Size type of flags enums, entries per flags enum is limited by this
+        int iterations = 10;
+        unsigned int jobs = 1; // Generator threads, 0 uses the hardware concurrency
+        uint32_t seed = 1;
+    };
+
+    struct phase_timing {
+        std::vector<double> samples_ms;
+        allocation_stats allocations; // Summed over all samples
+
+        void add(std::chrono::steady_clock::duration d, const allocation_stats &a) {
+            samples_ms.push_back(std::chrono::duration<double, std::milli>(d).count());
+            allocations.count += a.count;
+            allocations.bytes += a.bytes;
+        }
+
+        [[nodiscard]] json to_json() const {
+            double total = 0;
+            double min = samples_ms.empty() ? 0 : samples_ms.front();
+            double max = 0;
+            for (double s: samples_ms) {
+                total += s;
+                min = std::min(min, s);
+                max = std::max(max, s);
+            }
+            const double samples = samples_ms.empty() ? 1.0 : static_cast<double>(samples_ms.size());
+            return {
+                {"min_ms", min},
+                {"mean_ms", total / samples},
+                {"max_ms", max},
+                {"allocations", static_cast<double>(allocations.count) / samples},
+                {"allocated_mb", (static_cast<double>(allocations.bytes) / (1024.0 * 1024.0)) / samples},
+            };
+        }
+    };
+
+    // Unique identifier with a random prefix, the length is drawn from the configured distribution
+    std::string make_name(std::mt19937 &rng, const bench_options &opt, size_t index) {
+        static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        const std::string suffix = "_" + std::to_string(index);
+        std::uniform_int_distribution<int> length_dist(opt.name_min, opt.name_max);
+        std::uniform_int_distribution<int> char_dist(0, 25);
+
+        const int length = length_dist(rng);
+        std::string name;
+        do {
+            name += alphabet[char_dist(rng)];
+        } while (static_cast<int>(name.size() + suffix.size()) < length);
+        return name + suffix;
+    }
+
+    json make_config(const bench_options &opt) {
+        json size_types = json::array();
+        for (int bits: {8, 16, 32, 64}) {
+            size_types.push_back({{"name", "unsigned" + std::to_string(bits)}, {"bits", bits}, {"is_signed", false},
+                                  {"type_name", "uint" + std::to_string(bits) + "_t"}});
+            size_types.push_back({{"name", "signed" + std::to_string(bits)}, {"bits", bits}, {"is_signed", true},
+                                  {"type_name", "int" + std::to_string(bits) + "_t"}});
+        }
+        return {
+            {"enumbra_config", {
+                {"cpp_generator", {
+                    {"output_namespace", {"bench"}},
+                    {"time_generated_in_header", false},
+                    {"preamble_text", json::array()},
+                    {"additional_includes", {"<cstdint>"}},
+                    {"default_flags_enum_size_type", "unsigned" + std::to_string(opt.flags_bits)},
+                    {"default_value_enum_size_type", "signed64"},
+                    {"string_table_layout", "name_and_description"},
+                    {"min_max_functions", true},
+                    {"bit_info_functions", true},
+                    {"enumbra_bitfield_macros", true},
+                    {"size_types", size_types},
+                }},
+            }},
+        };
+    }
+
+    json make_schema(const bench_options &opt, size_t &total_entries) {
+        std::mt19937 rng(opt.seed);
+        std::bernoulli_distribution skip(opt.sparsity);
+        size_t name_index = 0;
+        total_entries = 0;
+
+        json value_enums = json::array();
+        for (int i = 0; i < opt.value_enums; i++) {
+            json entries = json::array();
+            int64_t value = 0;
+            for (int v = 0; v < opt.entries; v++) {
+                while (skip(rng)) {
+                    value++;
+                }
+                entries.push_back({{"name", make_name(rng, opt, name_index++)}, {"value", value++}});
+            }
+            total_entries += entries.size();
+            value_enums.push_back({{"name", "ValueEnum_" + std::to_string(i)}, {"entries", entries}});
+        }
+
+        json flags_enums = json::array();
+        for (int i = 0; i < opt.flags_enums; i++) {
+            json entries = json::array();
+            for (int bit = 0; bit < opt.flags_bits; bit++) {
+                // Always keep the first bit so no enum is empty
+                if (bit > 0 && skip(rng)) {
+                    continue;
+                }
+                entries.push_back({{"name", make_name(rng, opt, name_index++)}, {"value", fmt::format("{:#x}", 1ULL << bit)}});
+            }
+            total_entries += entries.size();
+            flags_enums.push_back({{"name", "FlagsEnum_" + std::to_string(i)}, {"entries", entries}});
+        }
+
+        return {
+            {"enums", {
+                {"value_enum_default_value_style", "min"},
+                {"flags_enum_default_value_style", "zero"},
+                {"value_enums", value_enums},
+                {"flags_enums", flags_enums},
+            }},
+        };
+    }
+
+    void write_file(const std::filesystem::path &path, const std::string &content) {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+    }
+}
+
+int main(int argc, char **argv) {
+    try {
+        cxxopts::Options options("enumbra_bench", "Generates synthetic schemas and benchmarks enumbra generation.");
+        options.add_options()
+            ("h,help", "You are here.")
+            ("value-enums", "Number of value enums.", cxxopts::value<int>()->default_value("100"))
+            ("flags-enums", "Number of flags enums.", cxxopts::value<int>()->default_value("100"))
+            ("entries", "Entries per value enum.", cxxopts::value<int>()->default_value("50"))
+            ("name-min", "Minimum entry name length.", cxxopts::value<int>()->default_value("4"))
+            ("name-max", "Maximum entry name length.", cxxopts::value<int>()->default_value("24"))
+            ("sparsity", "Chance in [0, 1) that a value or flag bit is skipped.", cxxopts::value<double>()->default_value("0"))
+            ("flags-bits", "Size type bits of flags enums (8, 16, 32 or 64).", cxxopts::value<int>()->default_value("32"))
+            ("iterations", "Number of timed iterations.", cxxopts::value<int>()->default_value("10"))
+            ("j,jobs", "Number of generator threads, 0 uses all hardware threads.", cxxopts::value<unsigned int>()->default_value("1"))
+            ("seed", "Random seed.", cxxopts::value<int>()->default_value("1"))
+            ("schema-out", "Keep the generated config and schema in this directory.", cxxopts::value<std::string>())
+            ("o,output", "Write the JSON report to this file instead of stdout.", cxxopts::value<std::string>());
+
+        auto result = options.parse(argc, argv);
+        if (result.count("h")) {
+            printf("%s\n", options.help().c_str());
+            return 0;
+        }
+
+        bench_options opt;
+        opt.value_enums = result["value-enums"].as<int>();
+        opt.flags_enums = result["flags-enums"].as<int>();
+        opt.entries = result["entries"].as<int>();
+        opt.name_min = result["name-min"].as<int>();
+        opt.name_max = result["name-max"].as<int>();
+        opt.sparsity = result["sparsity"].as<double>();
+        opt.flags_bits = result["flags-bits"].as<int>();
+        opt.iterations = result["iterations"].as<int>();
+        opt.jobs = result["jobs"].as<unsigned int>();
+        opt.seed = static_cast<uint32_t>(result["seed"].as<int>());
+
+        if (opt.value_enums < 0 || opt.flags_enums < 0 || opt.entries < 1 || opt.iterations < 1) {
+            throw std::logic_error("enum counts must be >= 0, entries and iterations must be >= 1");
+        }
+        if (opt.name_min < 1 || opt.name_max < opt.name_min) {
+            throw std::logic_error("name lengths must satisfy 1 <= name-min <= name-max");
+        }
+        if (opt.sparsity < 0.0 || opt.sparsity >= 1.0) {
+            throw std::logic_error("sparsity must be in [0, 1)");
+        }
+        if (opt.flags_bits != 8 && opt.flags_bits != 16 && opt.flags_bits != 32 && opt.flags_bits != 64) {
+            throw std::logic_error("flags-bits must be one of 8, 16, 32, 64");
+        }
+
+        const std::filesystem::path dir = result.count("schema-out")
+                                          ? std::filesystem::path(result["schema-out"].as<std::string>())
+                                          : std::filesystem::temp_directory_path() / "enumbra_bench";
+        std::filesystem::create_directories(dir);
+        const auto config_path = (dir / "bench_config.json").string();
+        const auto schema_path = (dir / "bench_enum.json").string();
+
+        size_t total_entries = 0;
+        const std::string schema_text = make_schema(opt, total_entries).dump(2);
+        write_file(config_path, make_config(opt).dump(2));
+        write_file(schema_path, schema_text);
+
+        phase_timing load_config;
+        phase_timing load_schema;
+        phase_timing generate;
+        size_t output_bytes = 0;
+
+        for (int i = 0; i < opt.iterations; i++) {
+            auto a0 = get_allocation_stats();
+            auto t0 = std::chrono::steady_clock::now();
+            auto cfg = load_enumbra_config(config_path);
+            auto t1 = std::chrono::steady_clock::now();
+            auto a1 = get_allocation_stats();
+            auto meta = load_meta_config(cfg, schema_path);
+            auto t2 = std::chrono::steady_clock::now();
+            auto a2 = get_allocation_stats();
+            cpp_generator gen(cfg, meta, opt.jobs);
+            output_bytes = gen.generate_cpp_output().size();
+            auto t3 = std::chrono::steady_clock::now();
+            auto a3 = get_allocation_stats();
+
+            load_config.add(t1 - t0, a1 - a0);
+            load_schema.add(t2 - t1, a2 - a1);
+            generate.add(t3 - t2, a3 - a2);
+        }
+
+        const json load_schema_json = load_schema.to_json();
+        const json generate_json = generate.to_json();
+        const double mean_total_s = (load_schema_json["mean_ms"].get<double>() + generate_json["mean_ms"].get<double>()) / 1000.0;
+        const double mean_generate_s = generate_json["mean_ms"].get<double>() / 1000.0;
+
+        json report = {
+            {"enumbra_version", enumbra::kEnumbraVersion},
+            {"value_enums", opt.value_enums},
+            {"flags_enums", opt.flags_enums},
+            {"total_entries", total_entries},
+            {"iterations", opt.iterations},
+            {"jobs", opt.jobs},
+            {"schema_bytes", schema_text.size()},
+            {"output_bytes", output_bytes},
+            {"phases", {
+                {"load_config", load_config.to_json()},
+                {"load_schema", load_schema_json},
+                {"generate", generate_json},
+            }},
+            {"throughput", {
+                {"entries_per_second", mean_total_s > 0 ? static_cast<double>(total_entries) / mean_total_s : 0},
+                {"output_mb_per_second", mean_generate_s > 0 ? (static_cast<double>(output_bytes) / (1024.0 * 1024.0)) / mean_generate_s : 0},
+            }},
+        };
+
+        const std::string report_text = report.dump(2);
+        if (result.count("o")) {
+            write_file(result["o"].as<std::string>(), report_text + "\n");
+        } else {
+            printf("%s\n", report_text.c_str());
+        }
+    }
+    catch (const std::exception &e) {
+        printf("%s\n", e.what());
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "fragment_cache.h"
+
+#include "cpp_utility.h"
+#include "generation_cache.h"
+#include "output_file.h"
+
+#include <system_error>
+
+#include <fmt/format.h>
+
+fragment_cache::fragment_cache(std::filesystem::path directory, uint64_t max_bytes)
+    : directory_(std::move(directory)), max_bytes_(max_bytes) {
+    std::error_code ec;
+    std::filesystem::create_directories(*directory_, ec);
+    if (ec) {
+        throw std::runtime_error(fmt::format("Failed to create cache directory: {} ({})", directory_->string(), ec.message()));
+    }
+}
+
+std::optional<std::string> fragment_cache::find(uint64_t key) {
+    if (directory_) {
+        // Not mirrored in memory, a one-shot run would otherwise hold the code of every enum twice
+        std::error_code ec;
+        const auto path = entry_path(key);
+        if (std::filesystem::exists(path, ec)) {
+            try {
+                std::string fragment = read_file_bytes(path);
+                touch_cache_entry(path);
+                hits_++;
+                return fragment;
+            } catch (const std::exception &) {
+                // Treat unreadable entries as a miss, they get rewritten
+            }
+        }
+    } else {
+        std::lock_guard lock(mutex_);
+        auto found = memory_.find(key);
+        if (found != memory_.end()) {
+            found->second.used = true;
+            hits_++;
+            return found->second.fragment;
+        }
+    }
+    misses_++;
+    return std::nullopt;
+}
+
+void fragment_cache::insert(uint64_t key, const std::string &fragment) {
+    if (directory_) {
+        write_file_atomic(entry_path(key), fragment);
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    memory_[key] = {fragment, true};
+}
+
+void fragment_cache::retain_used() {
+    std::lock_guard lock(mutex_);
+    for (auto it = memory_.begin(); it != memory_.end();) {
+        if (it->second.used) {
+            it->second.used = false;
+            ++it;
+        } else {
+            it = memory_.erase(it);
+        }
+    }
+}
+
+void fragment_cache::prune() const {
+    if (directory_) {
+        prune_cache_directory(*directory_, max_bytes_);
+    }
+}
+
+std::filesystem::path fragment_cache::entry_path(uint64_t key) const {
+    return *directory_ / fmt::format("{:016x}.fragment", key);
+}
+
+uint64_t hash_enum_definition(uint64_t seed, const enumbra::enum_definition &definition) {
+    const auto append_list = [](uint64_t hash, const std::vector<std::string> &list) {
+        hash = fnv1a_64_append(hash, std::to_string(list.size()));
+        for (const auto &item: list) {
+            hash = fnv1a_64_append(hash, item);
+        }
+        return hash;
+    };
+    const auto append_groups = [&](uint64_t hash, const std::vector<std::vector<std::string>> &groups) {
+        hash = fnv1a_64_append(hash, std::to_string(groups.size()));
+        for (const auto &group: groups) {
+            hash = append_list(hash, group);
+        }
+        return hash;
+    };
+    const auto append_relations = [&](uint64_t hash, const std::vector<enumbra::flags_relation> &relations) {
+        hash = fnv1a_64_append(hash, std::to_string(relations.size()));
+        for (const auto &r: relations) {
+            hash = fnv1a_64_append(hash, r.flag);
+            hash = append_list(hash, r.targets);
+        }
+        return hash;
+    };
+
+    uint64_t hash = seed;
+    hash = fnv1a_64_append(hash, definition.name);
+    hash = fnv1a_64_append(hash, std::to_string(definition.values.size()));
+    for (const auto &v: definition.values) {
+        hash = fnv1a_64_append(hash, v.name);
+        hash = fnv1a_64_append(hash, v.description);
+        const auto value = static_cast<uint128>(v.p_value);
+        hash = fnv1a_64_append(hash, fmt::format("{:x}:{:x}", absl::Uint128High64(value), absl::Uint128Low64(value)));
+    }
+    hash = fnv1a_64_append(hash, definition.default_value_name);
+    hash = append_groups(hash, definition.constraints.exclusive);
+    hash = append_groups(hash, definition.constraints.exactly_one);
+    hash = append_relations(hash, definition.constraints.requirements);
+    hash = append_relations(hash, definition.constraints.implications);
+    hash = fnv1a_64_append(hash, std::to_string(definition.presets.size()));
+    for (const auto &p: definition.presets) {
+        hash = fnv1a_64_append(hash, p.name);
+        hash = append_list(hash, p.flags);
+    }
+    hash = fnv1a_64_append(hash, definition.to_string_presets ? "1" : "0");
+    hash = fnv1a_64_append(hash, definition.out_of_line ? "1" : "0");
+    hash = fnv1a_64_append(hash, std::to_string(definition.size_type_index));
+    // group only selects the output file, it doesn't change the emitted code
+    return hash;
+}
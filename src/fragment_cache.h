@@ -0,0 +1,54 @@
+#pragma once
+
+#include "enumbra.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Cache of the code emitted for single enums, so regenerating a schema only re-emits the enums that changed.
+// Without a directory fragments live in memory, e.g. for watch sessions. With a directory they only live on disk,
+// where they can be shared by parallel invocations, and the directory is bounded by max_bytes like a
+// generation_cache (0 for no limit). All functions are thread-safe.
+class fragment_cache {
+public:
+    fragment_cache() = default;
+    fragment_cache(std::filesystem::path directory, uint64_t max_bytes);
+
+    [[nodiscard]] std::optional<std::string> find(uint64_t key);
+    void insert(uint64_t key, const std::string &fragment);
+
+    // Drops in-memory fragments that were not used since the last call, bounds memory in long running sessions
+    void retain_used();
+
+    // Removes the least recently used fragments of the directory while it is larger than max_bytes.
+    // Call once after a generation rather than per insert, it lists the whole directory.
+    void prune() const;
+
+    [[nodiscard]] size_t hits() const { return hits_; }
+    [[nodiscard]] size_t misses() const { return misses_; }
+
+private:
+    struct entry {
+        std::string fragment;
+        bool used = true;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, entry> memory_;
+    std::optional<std::filesystem::path> directory_;
+    uint64_t max_bytes_ = 0;
+    std::atomic<size_t> hits_{0};
+    std::atomic<size_t> misses_{0};
+
+    [[nodiscard]] std::filesystem::path entry_path(uint64_t key) const;
+};
+
+// Hashes everything in an enum definition that affects its emitted code.
+// Must be updated when fields are added to enum_definition.
+uint64_t hash_enum_definition(uint64_t seed, const enumbra::enum_definition &definition);
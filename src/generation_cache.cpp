@@ -0,0 +1,201 @@
+#include "generation_cache.h"
+
+#include "cpp_utility.h"
+#include "enumbra.h"
+#include "mapped_file.h"
+#include "output_file.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+generation_cache::generation_cache(std::filesystem::path directory, uint64_t max_bytes)
+    : directory_(std::move(directory)), max_bytes_(max_bytes) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+        throw std::runtime_error(fmt::format("Failed to create cache directory: {} ({})", directory_.string(), ec.message()));
+    }
+}
+
+std::string generation_cache::make_key(std::string_view config_bytes, std::string_view schema_bytes, std::string_view flags) {
+    fnv1a_64_hash hash = fnv1a_64("");
+    hash = fnv1a_64_append(hash, enumbra::kEnumbraVersion);
+    hash = fnv1a_64_append(hash, flags);
+    hash = fnv1a_64_append(hash, config_bytes);
+    hash = fnv1a_64_append(hash, schema_bytes);
+
+    // Input sizes are part of the name to make collisions of the 64-bit hash even less likely
+    return fmt::format("{:016x}-{:x}-{:x}", hash, config_bytes.size(), schema_bytes.size());
+}
+
+std::optional<std::string> generation_cache::load(const std::string &key) const {
+    const auto path = entry_path(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        return std::nullopt;
+    }
+    touch_cache_entry(path);
+    return content;
+}
+
+void generation_cache::store(const std::string &key, std::string_view output) const {
+    write_file_atomic(entry_path(key), output);
+    prune_cache_directory(directory_, max_bytes_);
+}
+
+// File sets are stored as a header line followed by "<name>\n<size>\n<content>" for each file
+static constexpr std::string_view file_set_header = "enumbra-file-set 1\n";
+
+std::optional<std::vector<generation_cache::file>> generation_cache::load_files(const std::string &key) const {
+    const auto content = load(key);
+    if (!content || content->compare(0, file_set_header.size(), file_set_header) != 0) {
+        return std::nullopt;
+    }
+
+    std::vector<file> files;
+    size_t pos = file_set_header.size();
+    while (pos < content->size()) {
+        const size_t name_end = content->find('\n', pos);
+        const size_t size_end = (name_end == std::string::npos) ? std::string::npos : content->find('\n', name_end + 1);
+        if (size_end == std::string::npos) {
+            return std::nullopt;
+        }
+        file f;
+        f.name = content->substr(pos, name_end - pos);
+        const size_t size = std::strtoull(content->c_str() + name_end + 1, nullptr, 10);
+        if (size > content->size() - (size_end + 1)) {
+            return std::nullopt; // Truncated entry, treat as a miss
+        }
+        f.content = content->substr(size_end + 1, size);
+        files.push_back(std::move(f));
+        pos = size_end + 1 + size;
+    }
+    return files;
+}
+
+void generation_cache::store_files(const std::string &key, const std::vector<file> &files) const {
+    std::string content(file_set_header);
+    for (const auto &f: files) {
+        content += fmt::format("{}\n{}\n", f.name, f.content.size());
+        content += f.content;
+    }
+    store(key, content);
+}
+
+void generation_cache::store_file(const std::string &key, const std::filesystem::path &source) const {
+    copy_output_if_changed(source, file_path(key));
+    prune_cache_directory(directory_, max_bytes_);
+}
+
+std::optional<bool> generation_cache::restore_file(const std::string &key, const std::filesystem::path &path) const {
+    const auto entry = file_path(key);
+    std::error_code ec;
+    if (!std::filesystem::exists(entry, ec)) {
+        return std::nullopt;
+    }
+    bool written = false;
+    try {
+        written = copy_output_if_changed(entry, path);
+    } catch (const std::exception &) {
+        // Removed by another invocation's pruning, or unreadable. A real problem with path shows up again when the
+        // output is generated.
+        return std::nullopt;
+    }
+    touch_cache_entry(entry);
+    return written;
+}
+
+std::optional<compiled_schema> generation_cache::load_schema(const std::string &key) const {
+    const auto path = schema_path(key);
+    const mapped_file image(path);
+    if (!image.is_open()) {
+        return std::nullopt;
+    }
+    auto schema = read_schema_image(image.contents());
+    if (schema) {
+        touch_cache_entry(path);
+    }
+    return schema;
+}
+
+void generation_cache::store_schema(const std::string &key, const compiled_schema &schema) const {
+    write_file_atomic(schema_path(key), write_schema_image(schema));
+    prune_cache_directory(directory_, max_bytes_);
+}
+
+std::filesystem::path generation_cache::entry_path(const std::string &key) const {
+    return directory_ / (key + ".enumbra");
+}
+
+std::filesystem::path generation_cache::file_path(const std::string &key) const {
+    return directory_ / (key + ".output");
+}
+
+std::filesystem::path generation_cache::schema_path(const std::string &key) const {
+    return directory_ / (key + ".schema");
+}
+
+void touch_cache_entry(const std::filesystem::path &path) {
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+}
+
+void prune_cache_directory(const std::filesystem::path &directory, uint64_t max_bytes) {
+    if (max_bytes == 0) {
+        return;
+    }
+    struct cache_file {
+        std::filesystem::path path;
+        std::filesystem::file_time_type time;
+        uint64_t size;
+    };
+    std::vector<cache_file> files;
+    uint64_t total = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code entry_ec;
+        if (!it->is_regular_file(entry_ec) || it->path().extension() == ".tmp") {
+            continue;
+        }
+        const uint64_t size = it->file_size(entry_ec);
+        const auto time = it->last_write_time(entry_ec);
+        if (entry_ec) {
+            continue; // Removed by another invocation
+        }
+        files.push_back({it->path(), time, size});
+        total += size;
+    }
+    if (total <= max_bytes) {
+        return;
+    }
+    std::sort(files.begin(), files.end(), [](const cache_file &lhs, const cache_file &rhs) { return lhs.time < rhs.time; });
+    for (const auto &f: files) {
+        if (total <= max_bytes) {
+            break;
+        }
+        std::filesystem::remove(f.path, ec);
+        total -= f.size;
+    }
+}
+
+std::string read_file_bytes(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error(fmt::format("Failed to open file: {}", path.string()));
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        throw std::runtime_error(fmt::format("Failed to read file: {}", path.string()));
+    }
+    return content;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "schema_image.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Default size limit of a cache directory
+constexpr uint64_t default_cache_max_bytes = 1024ull * 1024 * 1024;
+
+// Content-addressed cache of generated outputs.
+// Entries are keyed by a hash of everything that affects the output, so a hit can be used without
+// loading the config or running the generator. Entries are written through a temp file and an atomic
+// rename, so a cache directory can be shared by parallel invocations on one machine.
+// Loaded entries are touched and every store removes the least recently used entries while the directory is
+// larger than max_bytes, 0 disables the limit. Subdirectories, e.g. the fragment cache, are not counted.
+class generation_cache {
+public:
+    explicit generation_cache(std::filesystem::path directory, uint64_t max_bytes = default_cache_max_bytes);
+
+    // Key for an output generated from the given inputs. flags should contain every option that changes the output.
+    [[nodiscard]] static std::string make_key(std::string_view config_bytes, std::string_view schema_bytes, std::string_view flags);
+
+    // Returns the cached output for key, or nullopt on a miss
+    [[nodiscard]] std::optional<std::string> load(const std::string &key) const;
+
+    // Stores output under key, replacing an existing entry
+    void store(const std::string &key, std::string_view output) const;
+
+    struct file {
+        std::string name;
+        std::string content;
+    };
+
+    // Same as load/store for outputs made of several files
+    [[nodiscard]] std::optional<std::vector<file>> load_files(const std::string &key) const;
+    void store_files(const std::string &key, const std::vector<file> &files) const;
+
+    // Single file outputs stored as a copy of the file, so large outputs are never read into memory.
+    // restore_file writes the stored file to path unless it has the same content, it returns nullopt on a miss and
+    // otherwise whether path was written.
+    void store_file(const std::string &key, const std::filesystem::path &source) const;
+    [[nodiscard]] std::optional<bool> restore_file(const std::string &key, const std::filesystem::path &path) const;
+
+    // Compiled schemas, keyed by make_key of the config and schema the image was compiled from.
+    // Images of another enumbra version or that can't be read are misses.
+    [[nodiscard]] std::optional<compiled_schema> load_schema(const std::string &key) const;
+    void store_schema(const std::string &key, const compiled_schema &schema) const;
+
+private:
+    std::filesystem::path directory_;
+    uint64_t max_bytes_ = default_cache_max_bytes;
+
+    [[nodiscard]] std::filesystem::path entry_path(const std::string &key) const;
+    [[nodiscard]] std::filesystem::path file_path(const std::string &key) const;
+    [[nodiscard]] std::filesystem::path schema_path(const std::string &key) const;
+};
+
+// Sets the mtime of a cache entry to now, so prune_cache_directory keeps it longer. Errors are ignored.
+void touch_cache_entry(const std::filesystem::path &path);
+
+// Removes the files of directory with the oldest mtime until the remaining files take at most max_bytes.
+// Temp files of writes in progress and subdirectories are left alone. Errors are ignored, parallel
+// invocations may be pruning the same directory.
+void prune_cache_directory(const std::filesystem::path &directory, uint64_t max_bytes);
+
+// Reads a whole file, throws std::runtime_error if it can't be read
+std::string read_file_bytes(const std::filesystem::path &path);
@@ -0,0 +1,461 @@
+#include "generation_job.h"
+
+#include "config_loader.h"
+#include "cpp_utility.h"
+#include "generation_cache.h"
+#include "output_file.h"
+#include "profiler.h"
+#include "schema_image.h"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+using namespace enumbra;
+
+std::string config_fingerprint(std::string_view config_bytes) {
+    return fmt::format("{:016x}-{:x}", fnv1a_64(config_bytes), config_bytes.size());
+}
+
+std::vector<generated_file> generate_job_files(const enumbra_config &config, const enum_meta_config &enum_config,
+                                              const generation_job &job, unsigned int jobs,
+                                              fragment_cache *fragments, std::string_view config_fingerprint,
+                                              const schema_validation *validation) {
+    std::vector<generated_file> files;
+    if (config.generate_cpp) {
+        cpp_generator cpp_gen(config, enum_config, jobs);
+        if (fragments) {
+            cpp_gen.set_fragment_cache(fragments, config_fingerprint);
+        }
+        if (validation) {
+            cpp_gen.set_validation(validation);
+        }
+        if (!job.shared_base.empty()) {
+            cpp_gen.set_shared_base(job.shared_base);
+        }
+        cpp_gen.set_out_of_line(!job.cppsrc.empty());
+        if (job.sharded) {
+            files = cpp_gen.generate_cpp_shards(job.shard_options);
+        } else {
+            const std::string &generated_cpp = cpp_gen.generate_cpp_output();
+            files.push_back({"", generated_cpp, cpp_gen.get_include_guard(), cpp_gen.get_include_guard_position()});
+        }
+        if (!job.cppsrc.empty()) {
+            files.push_back(generate_source_file(config, enum_config, job, jobs, validation));
+        }
+        if (!job.module_name.empty()) {
+            for (auto &f: generate_module_files(config, enum_config, job, jobs, fragments, config_fingerprint, validation)) {
+                files.push_back(std::move(f));
+            }
+        }
+    }
+    if (config.generate_csharp) {
+        // TODO
+    }
+    return files;
+}
+
+std::vector<generated_file> generate_module_files(const enumbra_config &config, const enum_meta_config &enum_config,
+                                                 const generation_job &job, unsigned int jobs,
+                                                 fragment_cache *fragments, std::string_view config_fingerprint,
+                                                 const schema_validation *validation) {
+    cpp_generator cpp_gen(config, enum_config, jobs);
+    if (fragments) {
+        cpp_gen.set_fragment_cache(fragments, config_fingerprint);
+    }
+    if (validation) {
+        cpp_gen.set_validation(validation);
+    }
+    cpp_module_options module_options;
+    module_options.module_name = job.module_name;
+    return cpp_gen.generate_cpp_module(module_options);
+}
+
+generated_file generate_source_file(const enumbra_config &config, const enum_meta_config &enum_config,
+                                    const generation_job &job, unsigned int jobs, const schema_validation *validation) {
+    if (job.sharded) {
+        throw std::logic_error("Out-of-line source files are only supported for single headers: " + job.cppsrc);
+    }
+    cpp_generator cpp_gen(config, enum_config, jobs);
+    if (validation) {
+        cpp_gen.set_validation(validation);
+    }
+    // Absolute names are used as is by job_output_path, the source doesn't have to be next to the header
+    return cpp_gen.generate_cpp_source(std::filesystem::absolute(job.cppsrc).lexically_normal().generic_string(),
+                                       shared_base_include_path(job.cppout, job.cppsrc));
+}
+
+bool write_shared_base(const enumbra_config &config, const std::filesystem::path &path) {
+    const enum_meta_config no_enums;
+    cpp_generator cpp_gen(config, no_enums);
+    const generated_file base = cpp_gen.generate_cpp_base(path.filename().string());
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path());
+    }
+    return write_output_if_changed(path, base.content, {base.include_guard, base.include_guard_position});
+}
+
+std::string shared_base_include_path(const std::filesystem::path &base, const std::filesystem::path &cppout) {
+    const auto header_dir = std::filesystem::absolute(cppout).parent_path();
+    const auto relative = std::filesystem::absolute(base).lexically_normal().lexically_relative(header_dir.lexically_normal());
+    return relative.empty() ? base.filename().generic_string() : relative.generic_string();
+}
+
+std::filesystem::path job_output_path(const generation_job &job, const std::string &name) {
+    // Files without a name are written to cppout, others are relative to the cppout directory,
+    // or to the directory of the header for single headers
+    if (name.empty()) {
+        return job.cppout;
+    }
+    return job.sharded ? std::filesystem::path(job.cppout) / name : std::filesystem::path(job.cppout).parent_path() / name;
+}
+
+generation_result write_job_files(const generation_job &job, const std::vector<generated_file> &files, bool print) {
+    generation_result result;
+    if (job.sharded) {
+        std::filesystem::create_directories(job.cppout);
+    }
+    for (const auto &f: files) {
+        if (print) {
+            printf("%s\n", f.content.c_str());
+        }
+        // Leave the file untouched when nothing changed so its mtime doesn't trigger rebuilds.
+        // Module units have no include guard to compare, they are compared as a whole.
+        result.outputs.push_back(job_output_path(job, f.name));
+        const bool written = f.include_guard.empty()
+            ? write_output_if_changed(result.outputs.back(), f.content)
+            : write_output_if_changed(result.outputs.back(), f.content, {f.include_guard, f.include_guard_position});
+        result.files_written += written ? 1 : 0;
+    }
+    result.files_total = files.size();
+    return result;
+}
+
+// Writes the cached files of job that changed
+static void restore_cached_files(const generation_job &job, const std::vector<generation_cache::file> &files, bool print,
+                                 generation_result &result) {
+    for (const auto &f: files) {
+        if (print) {
+            printf("%s\n", f.content.c_str());
+        }
+        result.outputs.push_back(job_output_path(job, f.name));
+        result.files_written += write_output_if_changed(result.outputs.back(), f.content) ? 1 : 0;
+    }
+    result.files_total += files.size();
+}
+
+generation_result run_generation_job(const enumbra_config &config, std::string_view config_bytes,
+                                     const generation_job &job, const generation_options &options) {
+    // Checked before anything is written, the header would otherwise be written without its module
+    if (!job.module_name.empty() && !is_valid_module_name(job.module_name)) {
+        throw std::logic_error(fmt::format("Module name is not a valid C++ module name (name = {})", job.module_name));
+    }
+
+    // A single header is streamed to its file, so large outputs are never held in memory as a whole.
+    // The cache stores a copy of the streamed file and the other files of the job as a file set.
+    const bool streamed = !job.sharded && config.generate_cpp && !config.generate_csharp;
+    const bool has_extra_files = !job.cppsrc.empty() || !job.module_name.empty();
+
+    // On a cache hit the schema is not even parsed
+    std::optional<generation_cache> cache;
+    std::string cache_key;
+    std::string extra_files_key;
+    std::string schema_key;
+    if (options.cache_dir) {
+        cache.emplace(*options.cache_dir, options.cache_max_bytes);
+        std::string cache_flags = job.sharded
+            ? fmt::format("cpp-shards;{};{};{}", job.shard_options.base_name, job.shard_options.umbrella_name, job.shard_options.extension)
+            : job.shared_base.empty() ? "cpp" : fmt::format("cpp-shared-base;{}", job.shared_base);
+        if (!job.module_name.empty()) {
+            cache_flags += fmt::format(";module;{}", job.module_name);
+        }
+        if (!job.cppsrc.empty()) {
+            // The source includes the header relative to itself, so moving either changes its content
+            cache_flags += fmt::format(";cppsrc;{};{}", std::filesystem::absolute(job.cppsrc).lexically_normal().generic_string(),
+                                       shared_base_include_path(job.cppout, job.cppsrc));
+        }
+        const std::string schema_bytes = read_file_bytes(job.source);
+        cache_key = generation_cache::make_key(config_bytes, schema_bytes, cache_flags);
+        extra_files_key = generation_cache::make_key(config_bytes, schema_bytes, cache_flags + ";extra-files");
+        schema_key = generation_cache::make_key(config_bytes, schema_bytes, "schema-image");
+
+        if (streamed) {
+            // The small extra files are loaded first, so nothing is written unless the whole output hits
+            std::optional<std::vector<generation_cache::file>> extra_files;
+            std::optional<bool> header_written;
+            {
+                const profile_scope scope("load_cached_output");
+                extra_files = has_extra_files ? cache->load_files(extra_files_key) : std::vector<generation_cache::file>();
+                if (extra_files) {
+                    header_written = cache->restore_file(cache_key, job.cppout);
+                }
+            }
+            if (header_written) {
+                generation_result result;
+                result.outputs.push_back(job.cppout);
+                result.files_written = *header_written ? 1 : 0;
+                result.files_total = 1;
+                if (options.print) {
+                    printf("%s\n", read_file_bytes(job.cppout).c_str());
+                }
+                const profile_scope scope("write_file");
+                restore_cached_files(job, *extra_files, options.print, result);
+                result.cache_hit = true;
+                return result;
+            }
+        } else {
+            std::optional<std::vector<generation_cache::file>> cached;
+            {
+                const profile_scope scope("load_cached_output");
+                cached = cache->load_files(cache_key);
+            }
+            if (cached) {
+                generation_result result;
+                if (job.sharded) {
+                    std::filesystem::create_directories(job.cppout);
+                }
+                const profile_scope scope("write_file");
+                restore_cached_files(job, *cached, options.print, result);
+                result.cache_hit = true;
+                return result;
+            }
+        }
+    }
+
+    // The whole output missed, but most enums of an edited schema are usually unchanged
+    std::optional<fragment_cache> fragments;
+    if (options.cache_dir) {
+        fragments.emplace(*options.cache_dir / "fragments", options.cache_max_bytes);
+    }
+
+    // A schema that was compiled before, e.g. with other output options, is neither parsed nor validated again
+    std::optional<compiled_schema> schema;
+    bool store_schema = false;
+    if (cache) {
+        {
+            const profile_scope scope("load_schema_image");
+            schema = cache->load_schema(schema_key);
+        }
+        if (!schema) {
+            schema = compile_schema(config, load_meta_config(config, job.source), options.jobs);
+            store_schema = true;
+        }
+    }
+    const enum_meta_config enum_config = schema ? enum_meta_config{} : load_meta_config(config, job.source);
+    const enum_meta_config &meta = schema ? schema->meta : enum_config;
+    const schema_validation *validation = schema ? &schema->validation : nullptr;
+
+    if (streamed) {
+        generation_result result;
+        {
+            output_file_writer writer(job.cppout);
+            cpp_generator cpp_gen(config, meta, options.jobs);
+            if (fragments) {
+                cpp_gen.set_fragment_cache(&*fragments, config_fingerprint(config_bytes));
+            }
+            cpp_gen.set_validation(validation);
+            if (!job.shared_base.empty()) {
+                cpp_gen.set_shared_base(job.shared_base);
+            }
+            cpp_gen.set_out_of_line(!job.cppsrc.empty());
+            cpp_gen.generate_cpp_output(writer);
+            const output_signature signature{cpp_gen.get_include_guard(), cpp_gen.get_include_guard_position()};
+            const profile_scope scope("write_file");
+            result.files_written = writer.commit(signature) ? 1 : 0;
+            result.files_total = 1;
+            result.outputs.push_back(job.cppout);
+        }
+
+        // Files generated besides the header, the out-of-line source and the module units
+        std::vector<generated_file> extra_files;
+        if (!job.cppsrc.empty()) {
+            extra_files.push_back(generate_source_file(config, meta, job, options.jobs, validation));
+        }
+        if (!job.module_name.empty()) {
+            for (auto &f: generate_module_files(config, meta, job, options.jobs,
+                                                fragments ? &*fragments : nullptr, config_fingerprint(config_bytes), validation)) {
+                extra_files.push_back(std::move(f));
+            }
+        }
+        if (!extra_files.empty()) {
+            const generation_result extra_result = write_job_files(job, extra_files, false);
+            result.files_written += extra_result.files_written;
+            result.files_total += extra_result.files_total;
+            result.outputs.insert(result.outputs.end(), extra_result.outputs.begin(), extra_result.outputs.end());
+        }
+
+        if (options.print) {
+            printf("%s\n", read_file_bytes(job.cppout).c_str());
+            for (const auto &f: extra_files) {
+                printf("%s\n", f.content.c_str());
+            }
+        }
+        if (cache) {
+            // The header is copied file to file, reading it back would undo the flat memory use of streaming
+            const profile_scope scope("store_cached_output");
+            cache->store_file(cache_key, job.cppout);
+            if (!extra_files.empty()) {
+                std::vector<generation_cache::file> cached;
+                for (auto &f: extra_files) {
+                    cached.push_back({std::move(f.name), std::move(f.content)});
+                }
+                cache->store_files(extra_files_key, cached);
+            }
+        }
+        if (store_schema) {
+            const profile_scope scope("store_schema_image");
+            cache->store_schema(schema_key, *schema);
+        }
+        if (fragments) {
+            fragments->prune();
+        }
+        return result;
+    }
+
+    const auto files = generate_job_files(config, meta, job, options.jobs,
+                                          fragments ? &*fragments : nullptr, config_fingerprint(config_bytes), validation);
+    generation_result result;
+    {
+        const profile_scope scope("write_file");
+        result = write_job_files(job, files, options.print);
+    }
+
+    if (cache) {
+        const profile_scope scope("store_cached_output");
+        std::vector<generation_cache::file> cached;
+        for (const auto &f: files) {
+            cached.push_back({f.name, f.content});
+        }
+        cache->store_files(cache_key, cached);
+    }
+    if (store_schema) {
+        const profile_scope scope("store_schema_image");
+        cache->store_schema(schema_key, *schema);
+    }
+    if (fragments) {
+        fragments->prune();
+    }
+
+    return result;
+}
+
+std::vector<generation_result> run_generation_jobs(const enumbra_config &config, std::string_view config_bytes,
+                                                   const std::vector<generation_job> &jobs, const generation_options &options) {
+    std::vector<generation_result> results(jobs.size());
+
+    if (options.shared_base) {
+        write_shared_base(config, *options.shared_base);
+    }
+
+    // Parallelize across schemas when there are several, a single schema parallelizes across its enums instead
+    generation_options job_options = options;
+    if (jobs.size() > 1) {
+        job_options.jobs = 1;
+    }
+
+    run_parallel(jobs.size(), jobs.size() > 1 ? options.jobs : 1, [&](size_t i) {
+        try {
+            results[i] = run_generation_job(config, config_bytes, jobs[i], job_options);
+        } catch (const std::exception &e) {
+            throw std::runtime_error(fmt::format("{}: {}", jobs[i].source, e.what()));
+        }
+    });
+
+    return results;
+}
+
+namespace {
+    // Make syntax, as read by Ninja and the Makefile generators
+    std::string escape_depfile_path(const std::string &path) {
+        std::string escaped;
+        for (const char c: path) {
+            if (c == ' ' || c == '#') {
+                escaped += '\\';
+            } else if (c == '$') {
+                escaped += '$';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+}
+
+std::string make_depfile(const std::vector<std::string> &inputs, const std::vector<generation_job> &jobs,
+                         const std::vector<generation_result> &results, const std::string &stamp) {
+    const auto rule = [&](const std::string &target, const std::vector<const generation_job *> &target_jobs) {
+        std::string line = escape_depfile_path(std::filesystem::path(target).generic_string()) + ':';
+        for (const auto &input: inputs) {
+            line += ' ' + escape_depfile_path(std::filesystem::path(input).generic_string());
+        }
+        for (const auto *job: target_jobs) {
+            line += ' ' + escape_depfile_path(std::filesystem::path(job->source).generic_string());
+        }
+        return line + '\n';
+    };
+
+    if (!stamp.empty()) {
+        std::vector<const generation_job *> all_jobs;
+        for (const auto &job: jobs) {
+            all_jobs.push_back(&job);
+        }
+        return rule(stamp, all_jobs);
+    }
+
+    std::string depfile;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        for (const auto &output: results[i].outputs) {
+            depfile += rule(output.string(), {&jobs[i]});
+        }
+    }
+    return depfile;
+}
+
+generation_manifest load_generation_manifest(const std::string &manifest_file) {
+    std::ifstream file(manifest_file);
+    if (!file) {
+        throw std::logic_error("Manifest file does not exist: " + manifest_file);
+    }
+    json data = json::parse(file, nullptr, true, true);
+
+    const std::filesystem::path base = std::filesystem::path(manifest_file).parent_path();
+    const auto resolve = [&](const std::string &path) {
+        return (base / path).lexically_normal().string();
+    };
+
+    generation_manifest manifest;
+    if (data.contains("config")) {
+        manifest.config = resolve(data["config"].get<std::string>());
+    }
+    if (data.contains("shared_base")) {
+        manifest.shared_base = resolve(data["shared_base"].get<std::string>());
+    }
+    if (!data.contains("jobs") || !data["jobs"].is_array()) {
+        throw std::logic_error("Manifest requires a \"jobs\" array: " + manifest_file);
+    }
+    for (auto &entry: data["jobs"]) {
+        generation_job job;
+        job.source = resolve(entry["source"].get<std::string>());
+        if (entry.contains("cppout") == entry.contains("cppout_dir")) {
+            throw std::logic_error("Manifest job requires exactly one of \"cppout\" and \"cppout_dir\": " + job.source);
+        }
+        if (entry.contains("cppout_dir")) {
+            job.sharded = true;
+            job.cppout = resolve(entry["cppout_dir"].get<std::string>());
+            job.shard_options.base_name = entry.value("base_header", job.shard_options.base_name);
+            job.shard_options.umbrella_name = entry.value("umbrella", "");
+        } else {
+            job.cppout = resolve(entry["cppout"].get<std::string>());
+        }
+        job.module_name = entry.value("module", "");
+        if (entry.contains("cppsrc")) {
+            if (job.sharded) {
+                throw std::logic_error("Manifest job \"cppsrc\" requires \"cppout\": " + job.source);
+            }
+            job.cppsrc = resolve(entry["cppsrc"].get<std::string>());
+        }
+        manifest.jobs.push_back(std::move(job));
+    }
+    return manifest;
+}
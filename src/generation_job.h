@@ -0,0 +1,96 @@
+#pragma once
+
+#include "enumbra.h"
+#include "cpp_generator.h"
+#include "fragment_cache.h"
+#include "generation_cache.h"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+// One schema and where its output goes
+struct generation_job {
+    std::string source; // Path to enum.json
+    std::string cppout; // Header path, or the output directory when sharded
+    bool sharded = false;
+    cpp_shard_options shard_options;
+    std::string shared_base; // Single header only: #include path of a shared base header to use instead of embedding the base
+    std::string module_name; // Also generate a C++20 module of this name, written next to the header or into the shard directory
+    std::string cppsrc; // Single header only: source file defining the string lookups of the enums marked "out_of_line"
+};
+
+// Options shared by every job of an invocation
+struct generation_options {
+    unsigned int jobs = 0; // Threads, 0 uses the hardware concurrency
+    bool print = false; // Print generated files to the console
+    std::optional<std::filesystem::path> cache_dir;
+    uint64_t cache_max_bytes = default_cache_max_bytes; // Size limit of the cache directory, 0 for none
+    std::optional<std::filesystem::path> shared_base; // Shared base header written for jobs with a shared_base
+};
+
+struct generation_result {
+    size_t files_written = 0; // Files whose content changed
+    size_t files_total = 0;
+    bool cache_hit = false;
+    std::vector<std::filesystem::path> outputs; // Every file of the job, written or not
+};
+
+// Generates the outputs of a loaded schema, files are named relative to the job output.
+// With a fragment cache only enums that changed are re-emitted, config_fingerprint must identify the config.
+// validation can pass the results of validate_schema for the same config and schema, e.g. from a schema image.
+std::vector<generated_file> generate_job_files(const enumbra::enumbra_config &config, const enumbra::enum_meta_config &enum_config,
+                                              const generation_job &job, unsigned int jobs,
+                                              fragment_cache *fragments = nullptr, std::string_view config_fingerprint = {},
+                                              const schema_validation *validation = nullptr);
+
+// Generates the C++20 module units of job, named relative to the job output like the files of generate_job_files
+std::vector<generated_file> generate_module_files(const enumbra::enumbra_config &config, const enumbra::enum_meta_config &enum_config,
+                                                 const generation_job &job, unsigned int jobs,
+                                                 fragment_cache *fragments = nullptr, std::string_view config_fingerprint = {},
+                                                 const schema_validation *validation = nullptr);
+
+// Generates the source file of job's out-of-line enums, named by its absolute path. Throws for sharded jobs.
+generated_file generate_source_file(const enumbra::enumbra_config &config, const enumbra::enum_meta_config &enum_config,
+                                    const generation_job &job, unsigned int jobs, const schema_validation *validation = nullptr);
+
+// Writes the base header of a config that single headers include with generation_job::shared_base, if it changed
+bool write_shared_base(const enumbra::enumbra_config &config, const std::filesystem::path &path);
+
+// #include path of a shared base header in a header generated to cppout
+std::string shared_base_include_path(const std::filesystem::path &base, const std::filesystem::path &cppout);
+
+// Fingerprint of a config file for fragment caches
+std::string config_fingerprint(std::string_view config_bytes);
+
+// Writes the generated files of job that changed
+generation_result write_job_files(const generation_job &job, const std::vector<generated_file> &files, bool print);
+
+// Loads the schema of job against an already loaded config, generates the outputs and writes the files that changed.
+// config_bytes is the raw config file, only used for the cache key. Throws on invalid schemas.
+generation_result run_generation_job(const enumbra::enumbra_config &config, std::string_view config_bytes,
+                                     const generation_job &job, const generation_options &options);
+
+// Runs independent jobs in parallel, results are in the same order as jobs.
+// On failure the error of the first failing job is rethrown, prefixed with its schema path.
+std::vector<generation_result> run_generation_jobs(const enumbra::enumbra_config &config, std::string_view config_bytes,
+                                                   const std::vector<generation_job> &jobs, const generation_options &options);
+
+// Make-style dependency file listing, for each output of the jobs, the inputs shared by every job (config, manifest)
+// and the schema of the job. Used by build systems to regenerate only the outputs whose inputs changed.
+// With a stamp file, a single rule makes the stamp depend on every input instead.
+std::string make_depfile(const std::vector<std::string> &inputs, const std::vector<generation_job> &jobs,
+                         const std::vector<generation_result> &results, const std::string &stamp = {});
+
+// Loads a manifest of jobs:
+// { "config": "enumbra_config.json", "jobs": [ { "source": "a.json", "cppout": "a.hpp" },
+//   { "source": "b.json", "cppout_dir": "b", "base_header": "enumbra_base.hpp", "umbrella": "b.hpp", "module": "b" },
+//   { "source": "c.json", "cppout": "c.hpp", "cppsrc": "c.cpp" } ] }
+// Relative paths are resolved against the directory of the manifest. "config" is optional.
+struct generation_manifest {
+    std::string config;
+    std::string shared_base; // Optional "shared_base" path
+    std::vector<generation_job> jobs;
+};
+generation_manifest load_generation_manifest(const std::string &manifest_file);
@@ -0,0 +1,79 @@
+#include "libenumbra.h"
+
+#include "config_loader.h"
+#include "generation_job.h"
+#include "schema_image.h"
+
+#include <exception>
+
+namespace libenumbra {
+    struct config {
+        enumbra::enumbra_config value;
+    };
+
+    struct schema {
+        enumbra::enum_meta_config meta;
+        schema_validation validation;
+    };
+}
+
+using namespace libenumbra;
+
+config_result libenumbra::load_config(std::string_view config_json) {
+    config_result result;
+    try {
+        result.value = std::make_shared<const config>(config{parse_enumbra_config_text(config_json)});
+    } catch (const std::exception &e) {
+        result.diagnostics.push_back({"config", e.what()});
+    }
+    return result;
+}
+
+schema_result libenumbra::load_schema(const config &cfg, std::string_view schema_json, unsigned int jobs) {
+    schema_result result;
+    try {
+        compiled_schema compiled = compile_schema(cfg.value, parse_meta_config_text(cfg.value, schema_json), jobs);
+        result.value = std::make_shared<const schema>(schema{std::move(compiled.meta), std::move(compiled.validation)});
+    } catch (const std::exception &e) {
+        result.diagnostics.push_back({"schema", e.what()});
+    }
+    return result;
+}
+
+generate_result libenumbra::generate(const config &cfg, const schema &s, const generate_options &options) {
+    generate_result result;
+    try {
+        generation_job job;
+        job.sharded = options.sharded;
+        if (!options.base_header.empty()) {
+            job.shard_options.base_name = options.base_header;
+        }
+        job.shard_options.umbrella_name = options.umbrella;
+        job.module_name = options.module_name;
+
+        for (auto &f: generate_job_files(cfg.value, s.meta, job, options.jobs, nullptr, {}, &s.validation)) {
+            result.files.push_back({std::move(f.name), std::move(f.content)});
+        }
+        result.success = true;
+    } catch (const std::exception &e) {
+        result.files.clear();
+        result.diagnostics.push_back({"generate", e.what()});
+    }
+    return result;
+}
+
+generate_result libenumbra::generate(std::string_view config_json, std::string_view schema_json, const generate_options &options) {
+    const config_result cfg = load_config(config_json);
+    if (!cfg.value) {
+        return {false, {}, cfg.diagnostics};
+    }
+    const schema_result s = load_schema(*cfg.value, schema_json, options.jobs);
+    if (!s.value) {
+        return {false, {}, s.diagnostics};
+    }
+    return generate(*cfg.value, *s.value, options);
+}
+
+const char *libenumbra::version() {
+    return enumbra::kEnumbraVersion;
+}
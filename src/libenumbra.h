@@ -0,0 +1,82 @@
+#pragma once
+
+// In-process generation API of libenumbra. Configs, schemas and outputs are passed as memory buffers,
+// nothing is read from or written to disk. Only standard library types cross this interface, so the
+// shared library can be used without the JSON, fmt or abseil headers.
+//
+// Errors are returned as diagnostics rather than thrown. All functions are thread-safe, loaded configs
+// and schemas are immutable and can be shared between threads and calls.
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(ENUMBRA_SHARED)
+#if defined(_WIN32)
+#if defined(ENUMBRA_BUILDING_LIBRARY)
+#define ENUMBRA_API __declspec(dllexport)
+#else
+#define ENUMBRA_API __declspec(dllimport)
+#endif
+#else
+#define ENUMBRA_API __attribute__((visibility("default")))
+#endif
+#else
+#define ENUMBRA_API
+#endif
+
+namespace libenumbra {
+    struct diagnostic {
+        std::string stage; // "config", "schema" or "generate"
+        std::string message;
+    };
+
+    struct output_file {
+        std::string name; // Empty for a single header, otherwise relative to the output directory
+        std::string content;
+    };
+
+    struct generate_options {
+        unsigned int jobs = 1; // Threads, 0 uses the hardware concurrency. Output is identical for any value.
+        bool sharded = false; // One header per enum or group plus a base header, like --cppout-dir
+        std::string base_header; // Name of the base header of sharded output, empty for the default
+        std::string umbrella; // Name of a header including every shard, none if empty
+        std::string module_name; // Also generate the C++20 module units <name>.cppm and <name>-base.cppm, none if empty
+    };
+
+    // Opaque, defined by the library
+    struct config;
+    struct schema;
+
+    struct config_result {
+        std::shared_ptr<const config> value; // Null on failure
+        std::vector<diagnostic> diagnostics;
+    };
+
+    struct schema_result {
+        std::shared_ptr<const schema> value; // Null on failure
+        std::vector<diagnostic> diagnostics;
+    };
+
+    struct generate_result {
+        bool success = false;
+        std::vector<output_file> files;
+        std::vector<diagnostic> diagnostics;
+    };
+
+    // Loads the contents of an enumbra_config.json
+    ENUMBRA_API config_result load_config(std::string_view config_json);
+
+    // Loads and validates the contents of an enum.json against a loaded config
+    ENUMBRA_API schema_result load_schema(const config &cfg, std::string_view schema_json, unsigned int jobs = 1);
+
+    // Generates the outputs of a loaded schema, cfg must be the config the schema was loaded with
+    ENUMBRA_API generate_result generate(const config &cfg, const schema &s, const generate_options &options = {});
+
+    // Loads, validates and generates in one call
+    ENUMBRA_API generate_result generate(std::string_view config_json, std::string_view schema_json, const generate_options &options = {});
+
+    // Library version, same as the enumbra executable's
+    ENUMBRA_API const char *version();
+}
@@ -0,0 +1,53 @@
+#include "mapped_file.h"
+
+#include <fstream>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+mapped_file::mapped_file(const std::filesystem::path &path) {
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        open_ = true;
+        if (st.st_size == 0) {
+            ::close(fd);
+            return;
+        }
+        void *data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data != MAP_FAILED) {
+            ::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+            data_ = static_cast<const char *>(data);
+            size_ = static_cast<size_t>(st.st_size);
+            mapped_ = true;
+            return;
+        }
+    } else {
+        ::close(fd);
+    }
+#endif
+    // Not mappable (pipes, other platforms), read it instead
+    std::ifstream file(path, std::ios::binary);
+    open_ = static_cast<bool>(file);
+    fallback_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+}
+
+mapped_file::~mapped_file() {
+#if !defined(_WIN32)
+    if (mapped_) {
+        ::munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+}
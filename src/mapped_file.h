@@ -0,0 +1,26 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+// Read-only contents of a file, memory mapped where supported and read into memory otherwise.
+// A file that can't be opened has empty contents, check is_open() to tell it apart from an empty file.
+class mapped_file {
+public:
+    explicit mapped_file(const std::filesystem::path &path);
+    ~mapped_file();
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    [[nodiscard]] bool is_open() const { return open_; }
+    [[nodiscard]] std::string_view contents() const { return {data_, size_}; }
+
+private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    bool open_ = false;
+    bool mapped_ = false;
+    std::string fallback_; // Contents when the file is not mapped
+};
@@ -0,0 +1,295 @@
+#include "output_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Unique per process and call, so parallel invocations writing the same output don't share a temp file
+    std::filesystem::path make_temp_path(const std::filesystem::path &path) {
+        static std::atomic<uint64_t> counter{0};
+        static const uint64_t process_tag = std::random_device{}();
+        std::filesystem::path temp_path = path;
+        temp_path += fmt::format(".{:x}.{}.tmp", process_tag, counter++);
+        return temp_path;
+    }
+
+    // The rename replaces the target's inode, so carry its mode (and owner where allowed) over to the temp file
+    void copy_target_attributes(const std::filesystem::path &temp_path, const std::filesystem::path &path) {
+#if defined(_WIN32)
+        std::error_code ec;
+        const auto target_status = std::filesystem::status(path, ec);
+        if (!ec && std::filesystem::is_regular_file(target_status)) {
+            std::filesystem::permissions(temp_path, target_status.permissions(), std::filesystem::perm_options::replace, ec);
+        }
+#else
+        struct stat target_stat{};
+        if (::stat(path.c_str(), &target_stat) != 0 || !S_ISREG(target_stat.st_mode)) {
+            return;
+        }
+        // Failing to change the owner (not root, foreign group) keeps the writer's ownership
+        if (::chown(temp_path.c_str(), target_stat.st_uid, target_stat.st_gid) != 0) {
+            (void)::chown(temp_path.c_str(), static_cast<uid_t>(-1), target_stat.st_gid);
+        }
+        // After chown, which may clear setuid/setgid bits
+        (void)::chmod(temp_path.c_str(), target_stat.st_mode & 07777);
+#endif
+    }
+
+    void replace_file(const std::filesystem::path &temp_path, const std::filesystem::path &path) {
+        copy_target_attributes(temp_path, path);
+        std::error_code ec;
+        std::filesystem::rename(temp_path, path, ec);
+        if (ec) {
+            const std::string reason = ec.message();
+            std::filesystem::remove(temp_path, ec);
+            throw std::runtime_error(fmt::format("Failed to replace output file: {} ({})", path.string(), reason));
+        }
+    }
+
+    // Compares two files in chunks, false if either can't be read
+    bool files_equal(const std::filesystem::path &lhs, const std::filesystem::path &rhs) {
+        std::error_code ec;
+        const auto lhs_size = std::filesystem::file_size(lhs, ec);
+        if (ec) {
+            return false;
+        }
+        const auto rhs_size = std::filesystem::file_size(rhs, ec);
+        if (ec || lhs_size != rhs_size) {
+            return false;
+        }
+        std::ifstream lhs_file(lhs, std::ios::binary);
+        std::ifstream rhs_file(rhs, std::ios::binary);
+        if (!lhs_file || !rhs_file) {
+            return false;
+        }
+        constexpr size_t chunk_size = 64 * 1024;
+        std::string lhs_chunk(chunk_size, '\0');
+        std::string rhs_chunk(chunk_size, '\0');
+        while (true) {
+            lhs_file.read(lhs_chunk.data(), chunk_size);
+            rhs_file.read(rhs_chunk.data(), chunk_size);
+            const auto count = lhs_file.gcount();
+            if (count != rhs_file.gcount() || std::memcmp(lhs_chunk.data(), rhs_chunk.data(), static_cast<size_t>(count)) != 0) {
+                return false;
+            }
+            if (count == 0 || !lhs_file || !rhs_file) {
+                return !lhs_file.bad() && !rhs_file.bad();
+            }
+        }
+    }
+}
+
+bool output_file_matches(const std::filesystem::path &path, size_t size, const output_signature &signature) {
+    std::error_code ec;
+    const auto existing_size = std::filesystem::file_size(path, ec);
+    if (ec || existing_size != size) {
+        return false;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file || !file.seekg(static_cast<std::streamoff>(signature.marker_position))) {
+        return false;
+    }
+    std::string existing_marker(signature.marker.size(), '\0');
+    if (!file.read(existing_marker.data(), static_cast<std::streamsize>(existing_marker.size()))) {
+        return false;
+    }
+    return existing_marker == signature.marker;
+}
+
+void write_file_atomic(const std::filesystem::path &path, std::string_view content) {
+    const std::filesystem::path temp_path = make_temp_path(path);
+
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        file.close();
+        if (!file) {
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            throw std::runtime_error(fmt::format("Failed to write output file: {}", temp_path.string()));
+        }
+    }
+
+    replace_file(temp_path, path);
+}
+
+bool write_output_if_changed(const std::filesystem::path &path, std::string_view content, const output_signature &signature) {
+    if (output_file_matches(path, content.size(), signature)) {
+        return false;
+    }
+    write_file_atomic(path, content);
+    return true;
+}
+
+bool write_output_if_changed(const std::filesystem::path &path, std::string_view content) {
+    std::error_code ec;
+    const auto existing_size = std::filesystem::file_size(path, ec);
+    if (!ec && existing_size == content.size()) {
+        std::ifstream file(path, std::ios::binary);
+        const std::string existing((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (file && existing == content) {
+            return false;
+        }
+    }
+    write_file_atomic(path, content);
+    return true;
+}
+
+bool copy_output_if_changed(const std::filesystem::path &source, const std::filesystem::path &path) {
+    if (files_equal(source, path)) {
+        return false;
+    }
+    const std::filesystem::path temp_path = make_temp_path(path);
+    std::error_code ec;
+    std::filesystem::copy_file(source, temp_path, std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) {
+        const std::string reason = ec.message();
+        std::filesystem::remove(temp_path, ec);
+        throw std::runtime_error(fmt::format("Failed to copy {} to output file: {} ({})", source.string(), path.string(), reason));
+    }
+    replace_file(temp_path, path);
+    return true;
+}
+
+output_file_writer::output_file_writer(std::filesystem::path path, size_t buffer_size)
+    : path_(std::move(path)), temp_path_(make_temp_path(path_)), buffer_size_(buffer_size) {
+#if defined(_WIN32)
+    fd_ = _wopen(temp_path_.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    fd_ = ::open(temp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+#endif
+    if (fd_ < 0) {
+        throw std::runtime_error(fmt::format("Failed to write output file: {}", temp_path_.string()));
+    }
+    buffer_.reserve(buffer_size_);
+}
+
+output_file_writer::~output_file_writer() {
+    // Not committed, or commit failed before the file was closed
+    if (fd_ >= 0) {
+#if defined(_WIN32)
+        _close(fd_);
+#else
+        ::close(fd_);
+#endif
+        std::error_code ec;
+        std::filesystem::remove(temp_path_, ec);
+    }
+}
+
+void output_file_writer::write(std::string_view data) {
+    if (buffer_.size() + data.size() > buffer_size_) {
+        flush_buffer();
+        // Large writes bypass the buffer
+        if (data.size() >= buffer_size_) {
+            write_fd(data);
+            flushed_ += data.size();
+            return;
+        }
+    }
+    buffer_.append(data.data(), data.size());
+}
+
+void output_file_writer::patch(size_t offset, std::string_view data) {
+    if (offset + data.size() > size()) {
+        throw std::logic_error("output_file_writer::patch: range is past the end of the output");
+    }
+    // Part in the file
+    if (offset < flushed_) {
+        const std::string_view in_file = data.substr(0, flushed_ - offset);
+#if defined(_WIN32)
+        const bool ok = _lseeki64(fd_, static_cast<__int64>(offset), SEEK_SET) >= 0 &&
+                        _write(fd_, in_file.data(), static_cast<unsigned int>(in_file.size())) == static_cast<int>(in_file.size()) &&
+                        _lseeki64(fd_, 0, SEEK_END) >= 0;
+#else
+        const bool ok = ::pwrite(fd_, in_file.data(), in_file.size(), static_cast<off_t>(offset)) == static_cast<ssize_t>(in_file.size());
+#endif
+        if (!ok) {
+            throw std::runtime_error(fmt::format("Failed to write output file: {}", temp_path_.string()));
+        }
+        data.remove_prefix(in_file.size());
+        offset = flushed_;
+    }
+    // Part still in the buffer
+    if (!data.empty()) {
+        buffer_.replace(offset - flushed_, data.size(), data.data(), data.size());
+    }
+}
+
+bool output_file_writer::commit(const output_signature &signature) {
+    flush_buffer();
+    try {
+        close_fd();
+    } catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(temp_path_, ec);
+        throw;
+    }
+    if (output_file_matches(path_, flushed_, signature)) {
+        std::error_code ec;
+        std::filesystem::remove(temp_path_, ec);
+        return false;
+    }
+    replace_file(temp_path_, path_);
+    return true;
+}
+
+void output_file_writer::flush_buffer() {
+    write_fd(buffer_);
+    flushed_ += buffer_.size();
+    buffer_.clear();
+}
+
+void output_file_writer::write_fd(std::string_view data) {
+    while (!data.empty()) {
+#if defined(_WIN32)
+        const auto written = _write(fd_, data.data(), static_cast<unsigned int>(std::min<size_t>(data.size(), INT_MAX)));
+#else
+        const auto written = ::write(fd_, data.data(), data.size());
+#endif
+        if (written <= 0) {
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(fmt::format("Failed to write output file: {}", temp_path_.string()));
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+}
+
+void output_file_writer::close_fd() {
+    if (fd_ < 0) {
+        return;
+    }
+#if defined(_WIN32)
+    const int result = _close(fd_);
+#else
+    const int result = ::close(fd_);
+#endif
+    fd_ = -1;
+    if (result != 0) {
+        throw std::runtime_error(fmt::format("Failed to write output file: {}", temp_path_.string()));
+    }
+}
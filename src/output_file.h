@@ -0,0 +1,81 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+// All files are written in binary mode, the generated "\n" line endings are kept on every platform so the
+// bytes on disk can be compared with the generated content.
+
+// Identifies generated content without reading all of it.
+// The include guard embeds the FNV-1a hash of the output, so a file with the same size and the same
+// guard at the same position has the same content.
+struct output_signature {
+    std::string_view marker;
+    size_t marker_position = 0;
+};
+
+// Returns true if the file at path has the given size and contains signature.marker at signature.marker_position.
+bool output_file_matches(const std::filesystem::path &path, size_t size, const output_signature &signature);
+
+// Writes content to a temporary file next to path and renames it over path, so readers only ever see
+// the old or the new file. An existing file keeps its permissions. Throws std::runtime_error on failure.
+void write_file_atomic(const std::filesystem::path &path, std::string_view content);
+
+// Writes content to path only if it differs from the existing file, leaving the mtime of unchanged
+// outputs alone so dependent translation units are not rebuilt. Returns true if the file was written.
+bool write_output_if_changed(const std::filesystem::path &path, std::string_view content, const output_signature &signature);
+
+// Same as above for content without a signature, compares the whole existing file.
+bool write_output_if_changed(const std::filesystem::path &path, std::string_view content);
+
+// Copies source over path through a temporary file unless both have the same content, without reading either
+// into memory. Returns true if path was written. Throws std::runtime_error on failure.
+bool copy_output_if_changed(const std::filesystem::path &source, const std::filesystem::path &path);
+
+// Destination of output that is produced incrementally
+class output_sink {
+public:
+    virtual ~output_sink() = default;
+
+    // Appends data
+    virtual void write(std::string_view data) = 0;
+
+    // Overwrites bytes that were already written, e.g. slots reserved for a hash of the whole output
+    virtual void patch(size_t offset, std::string_view data) = 0;
+};
+
+// Buffered writer that streams output to a temporary file next to path. Patches to data that already left the
+// buffer are written in place with pwrite. commit() renames the temporary file over path unless the existing
+// file already matches, the temporary file is removed if the writer is destroyed without committing.
+// Throws std::runtime_error on failure.
+class output_file_writer final : public output_sink {
+public:
+    explicit output_file_writer(std::filesystem::path path, size_t buffer_size = 1 << 20);
+    ~output_file_writer() override;
+
+    output_file_writer(const output_file_writer &) = delete;
+    output_file_writer &operator=(const output_file_writer &) = delete;
+
+    void write(std::string_view data) override;
+    void patch(size_t offset, std::string_view data) override;
+
+    // Bytes written so far
+    [[nodiscard]] size_t size() const { return flushed_ + buffer_.size(); }
+
+    // Finishes the file with the same skip-unchanged semantics as write_output_if_changed.
+    // Returns true if path was replaced.
+    bool commit(const output_signature &signature);
+
+private:
+    std::filesystem::path path_;
+    std::filesystem::path temp_path_;
+    int fd_ = -1;
+    std::string buffer_;
+    size_t buffer_size_ = 0;
+    size_t flushed_ = 0; // Bytes in the file, the buffer follows them
+
+    void flush_buffer();
+    void write_fd(std::string_view data);
+    void close_fd();
+};
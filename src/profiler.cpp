@@ -0,0 +1,173 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+
+#include <fmt/format.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+    std::atomic<profiler *> current_profiler{nullptr};
+
+    // Small stable ids for the trace instead of std::thread::id
+    uint32_t current_thread_index() {
+        static std::atomic<uint32_t> next_index{0};
+        thread_local const uint32_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    double to_ms(std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    double to_mb(uint64_t bytes) {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+}
+
+void set_active_profiler(profiler *p) {
+    current_profiler.store(p, std::memory_order_release);
+}
+
+profiler *active_profiler() {
+    return current_profiler.load(std::memory_order_acquire);
+}
+
+uint64_t peak_rss_bytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss); // Bytes
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // Kilobytes
+#endif
+#endif
+}
+
+profiler::profiler()
+    : start_(std::chrono::steady_clock::now()), start_allocations_(get_allocation_stats()) { }
+
+void profiler::record(std::string_view name, std::string_view detail, std::chrono::steady_clock::time_point start,
+                      const allocation_stats &start_allocations) {
+    // Measure before recording so the event itself is not counted
+    const auto end = std::chrono::steady_clock::now();
+    const allocation_stats allocations = get_thread_allocation_stats() - start_allocations;
+
+    event e;
+    e.name = name;
+    e.detail = detail;
+    e.thread = current_thread_index();
+    e.start = start - start_;
+    e.duration = end - start;
+    e.allocations = allocations;
+    e.peak_rss = peak_rss_bytes();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(std::move(e));
+}
+
+std::vector<profiler::event> profiler::events() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_;
+}
+
+std::string profiler::report() const {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    const allocation_stats total_allocations = get_allocation_stats() - start_allocations_;
+    const std::vector<event> recorded = events();
+
+    // Phases in the order they first ran
+    struct phase_total {
+        size_t count = 0;
+        std::chrono::steady_clock::duration duration{};
+        allocation_stats allocations;
+    };
+    std::vector<std::string> phase_order;
+    std::map<std::string, phase_total> phases;
+    for (const auto &e: recorded) {
+        auto [it, inserted] = phases.try_emplace(e.name);
+        if (inserted) {
+            phase_order.push_back(e.name);
+        }
+        it->second.count++;
+        it->second.duration += e.duration;
+        it->second.allocations.count += e.allocations.count;
+        it->second.allocations.bytes += e.allocations.bytes;
+    }
+
+    std::string out;
+    out += "Phases (durations and allocations include nested phases, parallel phases are summed):\n";
+    out += fmt::format("  {:<28} {:>8} {:>12} {:>12} {:>12}\n", "phase", "count", "total ms", "allocations", "alloc MB");
+    for (const auto &name: phase_order) {
+        const auto &p = phases[name];
+        out += fmt::format("  {:<28} {:>8} {:>12.3f} {:>12} {:>12.2f}\n",
+                           name, p.count, to_ms(p.duration), p.allocations.count, to_mb(p.allocations.bytes));
+    }
+
+    // Enums are measured by the "enum" phase, which covers building and emitting one enum
+    std::vector<const event *> enums;
+    for (const auto &e: recorded) {
+        if (e.name == "enum") {
+            enums.push_back(&e);
+        }
+    }
+    constexpr size_t slowest_enum_count = 10;
+    const size_t shown = std::min(enums.size(), slowest_enum_count);
+    std::partial_sort(enums.begin(), enums.begin() + static_cast<std::ptrdiff_t>(shown), enums.end(),
+                      [](const event *lhs, const event *rhs) { return lhs->duration > rhs->duration; });
+    if (shown > 0) {
+        out += fmt::format("Slowest {} of {} enums (peak RSS is the process high-water mark when the enum finished):\n", shown, enums.size());
+        out += fmt::format("  {:<40} {:>10} {:>12} {:>10} {:>12}\n", "enum", "ms", "allocations", "alloc MB", "peak RSS MB");
+        for (size_t i = 0; i < shown; i++) {
+            const event &e = *enums[i];
+            out += fmt::format("  {:<40} {:>10.3f} {:>12} {:>10.2f} {:>12.1f}\n",
+                               e.detail, to_ms(e.duration), e.allocations.count, to_mb(e.allocations.bytes), to_mb(e.peak_rss));
+        }
+    }
+
+    out += fmt::format("Total: {:.3f} ms, {} allocations, {:.2f} MB allocated, peak RSS {:.1f} MB\n",
+                       to_ms(elapsed), total_allocations.count, to_mb(total_allocations.bytes), to_mb(peak_rss_bytes()));
+    return out;
+}
+
+json profiler::trace_events() const {
+    json trace_events = json::array();
+    for (const auto &e: events()) {
+        json args = {
+            {"allocations", e.allocations.count},
+            {"allocated_bytes", e.allocations.bytes},
+            {"peak_rss_bytes", e.peak_rss},
+        };
+        if (!e.detail.empty()) {
+            args["enum"] = e.detail;
+        }
+        trace_events.push_back({
+            {"name", e.detail.empty() ? e.name : fmt::format("{} {}", e.name, e.detail)},
+            {"cat", "enumbra"},
+            {"ph", "X"},
+            {"ts", std::chrono::duration<double, std::micro>(e.start).count()},
+            {"dur", std::chrono::duration<double, std::micro>(e.duration).count()},
+            {"pid", 1},
+            {"tid", e.thread},
+            {"args", std::move(args)},
+        });
+    }
+    return {{"traceEvents", std::move(trace_events)}, {"displayTimeUnit", "ms"}};
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "allocation_counter.h"
+#include "enumbra.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Records the duration, allocations and peak memory use of the phases of a generation.
+// Phases are measured with profile_scope and only recorded while a profiler is active, all functions are thread-safe.
+class profiler {
+public:
+    struct event {
+        std::string name; // Phase, e.g. "load_schema" or "emit_value_enum"
+        std::string detail; // Enum name for per-enum phases, otherwise empty
+        uint32_t thread = 0;
+        std::chrono::steady_clock::duration start{}; // Since the profiler was created
+        std::chrono::steady_clock::duration duration{};
+        allocation_stats allocations; // Made by the phase's thread, including nested phases
+        uint64_t peak_rss = 0; // Process peak resident set size in bytes when the phase ended
+    };
+
+    profiler();
+
+    void record(std::string_view name, std::string_view detail, std::chrono::steady_clock::time_point start,
+                const allocation_stats &start_allocations);
+
+    [[nodiscard]] std::vector<event> events() const;
+
+    // Per-phase totals, the slowest enums and totals of the whole run
+    [[nodiscard]] std::string report() const;
+
+    // Chrome trace event format, viewable in chrome://tracing or Perfetto
+    [[nodiscard]] json trace_events() const;
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    allocation_stats start_allocations_;
+    mutable std::mutex mutex_;
+    std::vector<event> events_;
+};
+
+// Makes p the profiler that scopes record into, nullptr stops profiling. p must outlive its use.
+void set_active_profiler(profiler *p);
+profiler *active_profiler();
+
+// Peak resident set size of the process in bytes, 0 where unsupported
+uint64_t peak_rss_bytes();
+
+// Measures the enclosing scope as a phase of the active profiler, does nothing without one.
+// name and detail must outlive the scope.
+class profile_scope {
+public:
+    explicit profile_scope(std::string_view name, std::string_view detail = {})
+        : profiler_(active_profiler()) {
+        if (profiler_) {
+            name_ = name;
+            detail_ = detail;
+            start_allocations_ = get_thread_allocation_stats();
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~profile_scope() {
+        if (profiler_) {
+            profiler_->record(name_, detail_, start_, start_allocations_);
+        }
+    }
+
+    profile_scope(const profile_scope &) = delete;
+    profile_scope &operator=(const profile_scope &) = delete;
+
+private:
+    profiler *profiler_;
+    std::string_view name_;
+    std::string_view detail_;
+    std::chrono::steady_clock::time_point start_;
+    allocation_stats start_allocations_;
+};
@@ -0,0 +1,409 @@
+#include "schema_image.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace enumbra;
+
+namespace {
+    constexpr char image_magic[8] = {'E', 'N', 'U', 'M', 'B', 'R', 'A', 'S'};
+    constexpr uint32_t image_format_version = 2;
+    constexpr uint32_t image_byte_order = 0x01020304;
+
+    struct image_header {
+        char magic[8];
+        uint32_t format_version;
+        uint32_t byte_order;
+        uint64_t version_offset; // enumbra version in the string pool
+        uint64_t version_size;
+        uint64_t entries_offset;
+        uint64_t entry_count;
+        uint64_t data_offset;
+        uint64_t data_count; // Words
+        uint64_t strings_offset;
+        uint64_t strings_size;
+    };
+
+    struct image_entry {
+        uint64_t name_offset;
+        uint64_t description_offset;
+        uint32_t name_size;
+        uint32_t description_size;
+        uint64_t value_low;
+        uint64_t value_high;
+    };
+
+    static_assert(sizeof(image_header) % 8 == 0, "Sections after the header must stay 8-byte aligned");
+    static_assert(sizeof(image_entry) % 8 == 0, "The data section after the entries must stay 8-byte aligned");
+
+    class image_writer {
+    public:
+        image_writer() {
+            version_offset_ = add_string(kEnumbraVersion);
+        }
+
+        void word(uint64_t w) { data_.push_back(w); }
+        void boolean(bool b) { word(b ? 1 : 0); }
+        void int128_value(int128 v) {
+            word(absl::Int128Low64(v));
+            word(static_cast<uint64_t>(absl::Int128High64(v)));
+        }
+        void string(std::string_view s) {
+            word(add_string(s));
+            word(s.size());
+        }
+        void strings(const std::vector<std::string> &v) {
+            word(v.size());
+            for (const auto &s: v) {
+                string(s);
+            }
+        }
+
+        // Appends the entries of an enum and returns the index of the first one
+        uint64_t entries(const std::vector<enum_entry> &values) {
+            const uint64_t first = entries_.size();
+            for (const auto &v: values) {
+                if (v.name.size() > UINT32_MAX || v.description.size() > UINT32_MAX) {
+                    throw std::logic_error("Schema image: entry name or description is too long");
+                }
+                image_entry e{};
+                e.name_offset = add_string(v.name);
+                e.name_size = static_cast<uint32_t>(v.name.size());
+                e.description_offset = add_string(v.description);
+                e.description_size = static_cast<uint32_t>(v.description.size());
+                e.value_low = absl::Int128Low64(v.p_value);
+                e.value_high = static_cast<uint64_t>(absl::Int128High64(v.p_value));
+                entries_.push_back(e);
+            }
+            return first;
+        }
+
+        std::string finish() const {
+            image_header h{};
+            std::memcpy(h.magic, image_magic, sizeof(image_magic));
+            h.format_version = image_format_version;
+            h.byte_order = image_byte_order;
+            h.version_offset = version_offset_;
+            h.version_size = std::string_view(kEnumbraVersion).size();
+            h.entries_offset = sizeof(image_header);
+            h.entry_count = entries_.size();
+            h.data_offset = h.entries_offset + entries_.size() * sizeof(image_entry);
+            h.data_count = data_.size();
+            h.strings_offset = h.data_offset + data_.size() * sizeof(uint64_t);
+            h.strings_size = strings_.size();
+
+            std::string image;
+            image.reserve(h.strings_offset + strings_.size());
+            image.append(reinterpret_cast<const char *>(&h), sizeof(h));
+            image.append(reinterpret_cast<const char *>(entries_.data()), entries_.size() * sizeof(image_entry));
+            image.append(reinterpret_cast<const char *>(data_.data()), data_.size() * sizeof(uint64_t));
+            image.append(strings_);
+            return image;
+        }
+
+    private:
+        std::vector<image_entry> entries_;
+        std::vector<uint64_t> data_;
+        std::string strings_;
+        uint64_t version_offset_ = 0;
+
+        uint64_t add_string(std::string_view s) {
+            const uint64_t offset = strings_.size();
+            strings_.append(s.data(), s.size());
+            return offset;
+        }
+    };
+
+    // Bounds-checked reads, a read past the end of a section marks the image as failed and returns empty values
+    class image_reader {
+    public:
+        image_reader(std::string_view image, const image_header &h)
+            : entries_(image.data() + h.entries_offset), entry_count_(h.entry_count),
+              data_(image.data() + h.data_offset), data_count_(h.data_count),
+              strings_(image.data() + h.strings_offset), strings_size_(h.strings_size) { }
+
+        [[nodiscard]] bool failed() const { return failed_; }
+        [[nodiscard]] bool at_end() const { return position_ == data_count_; }
+
+        uint64_t word() {
+            if (position_ >= data_count_) {
+                failed_ = true;
+                return 0;
+            }
+            uint64_t w;
+            std::memcpy(&w, data_ + position_ * sizeof(uint64_t), sizeof(w));
+            position_++;
+            return w;
+        }
+        bool boolean() { return word() != 0; }
+        int128 int128_value() {
+            const uint64_t low = word();
+            const uint64_t high = word();
+            return absl::MakeInt128(static_cast<int64_t>(high), low);
+        }
+        std::string string() {
+            const uint64_t offset = word();
+            const uint64_t size = word();
+            return string_at(offset, size);
+        }
+        std::vector<std::string> strings() {
+            std::vector<std::string> v(count());
+            for (auto &s: v) {
+                s = string();
+            }
+            return v;
+        }
+
+        // Number of items that follow, each takes at least one word
+        size_t count() {
+            const uint64_t n = word();
+            if (n > data_count_ - position_) {
+                failed_ = true;
+                return 0;
+            }
+            return static_cast<size_t>(n);
+        }
+
+        std::vector<enum_entry> entries(uint64_t first, uint64_t count) {
+            if (first > entry_count_ || count > entry_count_ - first) {
+                failed_ = true;
+                return {};
+            }
+            std::vector<enum_entry> values(static_cast<size_t>(count));
+            for (size_t i = 0; i < values.size(); i++) {
+                image_entry e;
+                std::memcpy(&e, entries_ + (first + i) * sizeof(image_entry), sizeof(e));
+                values[i].name = string_at(e.name_offset, e.name_size);
+                values[i].description = string_at(e.description_offset, e.description_size);
+                values[i].p_value = absl::MakeInt128(static_cast<int64_t>(e.value_high), e.value_low);
+            }
+            return values;
+        }
+
+        std::string string_at(uint64_t offset, uint64_t size) {
+            if (offset > strings_size_ || size > strings_size_ - offset) {
+                failed_ = true;
+                return {};
+            }
+            return {strings_ + offset, static_cast<size_t>(size)};
+        }
+
+    private:
+        const char *entries_;
+        uint64_t entry_count_;
+        const char *data_;
+        uint64_t data_count_;
+        const char *strings_;
+        uint64_t strings_size_;
+        uint64_t position_ = 0;
+        bool failed_ = false;
+    };
+
+    void write_relations(image_writer &w, const std::vector<flags_relation> &relations) {
+        w.word(relations.size());
+        for (const auto &r: relations) {
+            w.string(r.flag);
+            w.strings(r.targets);
+        }
+    }
+
+    std::vector<flags_relation> read_relations(image_reader &r) {
+        std::vector<flags_relation> relations(r.count());
+        for (auto &relation: relations) {
+            relation.flag = r.string();
+            relation.targets = r.strings();
+        }
+        return relations;
+    }
+
+    void write_groups(image_writer &w, const std::vector<std::vector<std::string>> &groups) {
+        w.word(groups.size());
+        for (const auto &g: groups) {
+            w.strings(g);
+        }
+    }
+
+    std::vector<std::vector<std::string>> read_groups(image_reader &r) {
+        std::vector<std::vector<std::string>> groups(r.count());
+        for (auto &g: groups) {
+            g = r.strings();
+        }
+        return groups;
+    }
+
+    void write_enum(image_writer &w, const enum_definition &def, const enum_validation &validation) {
+        w.string(def.name);
+        w.word(w.entries(def.values));
+        w.word(def.values.size());
+        w.string(def.default_value_name);
+        write_groups(w, def.constraints.exclusive);
+        write_groups(w, def.constraints.exactly_one);
+        write_relations(w, def.constraints.requirements);
+        write_relations(w, def.constraints.implications);
+        w.word(def.presets.size());
+        for (const auto &p: def.presets) {
+            w.string(p.name);
+            w.strings(p.flags);
+        }
+        w.boolean(def.to_string_presets);
+        w.string(def.group);
+        w.boolean(def.out_of_line);
+        w.word(def.size_type_index);
+
+        w.word(static_cast<uint64_t>(validation.unique_entry_count));
+        w.boolean(validation.is_contiguous);
+        w.boolean(validation.has_zero);
+        w.boolean(validation.has_minus_one);
+        w.boolean(validation.has_all_bits);
+    }
+
+    void read_enum(image_reader &r, enum_definition &def, enum_validation &validation) {
+        def.name = r.string();
+        const uint64_t first_entry = r.word();
+        const uint64_t entry_count = r.word();
+        def.values = r.entries(first_entry, entry_count);
+        def.default_value_name = r.string();
+        def.constraints.exclusive = read_groups(r);
+        def.constraints.exactly_one = read_groups(r);
+        def.constraints.requirements = read_relations(r);
+        def.constraints.implications = read_relations(r);
+        def.presets.resize(r.count());
+        for (auto &p: def.presets) {
+            p.name = r.string();
+            p.flags = r.strings();
+        }
+        def.to_string_presets = r.boolean();
+        def.group = r.string();
+        def.out_of_line = r.boolean();
+        def.size_type_index = static_cast<size_t>(r.word());
+
+        validation.unique_entry_count = static_cast<int64_t>(r.word());
+        validation.is_contiguous = r.boolean();
+        validation.has_zero = r.boolean();
+        validation.has_minus_one = r.boolean();
+        validation.has_all_bits = r.boolean();
+    }
+}
+
+compiled_schema compile_schema(enumbra_config config, enum_meta_config meta, unsigned int jobs) {
+    compiled_schema schema{std::move(config), std::move(meta), {}};
+    schema.validation = validate_schema(schema.config.cpp_config, schema.meta, jobs);
+    return schema;
+}
+
+std::string write_schema_image(const compiled_schema &schema) {
+    image_writer w;
+
+    // Config
+    const auto &cpp = schema.config.cpp_config;
+    w.boolean(schema.config.generate_cpp);
+    w.boolean(schema.config.generate_csharp);
+    w.strings(cpp.output_namespace);
+    w.strings(cpp.preamble_text);
+    w.strings(cpp.additional_includes);
+    w.boolean(cpp.time_generated_in_header);
+    w.word(cpp.size_types.size());
+    for (const auto &t: cpp.size_types) {
+        w.string(t.name);
+        w.word(static_cast<uint64_t>(static_cast<int64_t>(t.bits)));
+        w.boolean(t.is_signed);
+        w.string(t.type_name);
+        w.int128_value(t.min_possible_value);
+        w.int128_value(t.max_possible_value);
+    }
+    w.word(cpp.default_value_enum_size_type_index);
+    w.word(cpp.default_flags_enum_size_type_index);
+    w.word(static_cast<uint64_t>(cpp.string_table_layout));
+    w.word(static_cast<uint64_t>(cpp.simd_codegen));
+    w.boolean(cpp.min_max_functions);
+    w.boolean(cpp.bit_info_functions);
+    w.boolean(cpp.enumbra_bitfield_macros);
+
+    // Schema
+    const auto &meta = schema.meta;
+    w.word(static_cast<uint64_t>(meta.value_enum_default_value_style));
+    w.word(static_cast<uint64_t>(meta.flags_enum_default_value_style));
+    w.word(meta.value_enum_definitions.size());
+    for (size_t i = 0; i < meta.value_enum_definitions.size(); i++) {
+        write_enum(w, meta.value_enum_definitions[i], schema.validation.value_enums.at(i));
+    }
+    w.word(meta.flag_enum_definitions.size());
+    for (size_t i = 0; i < meta.flag_enum_definitions.size(); i++) {
+        write_enum(w, meta.flag_enum_definitions[i], schema.validation.flags_enums.at(i));
+    }
+
+    return w.finish();
+}
+
+std::optional<compiled_schema> read_schema_image(std::string_view image) {
+    image_header h{};
+    if (image.size() < sizeof(h)) {
+        return std::nullopt;
+    }
+    std::memcpy(&h, image.data(), sizeof(h));
+    if (std::memcmp(h.magic, image_magic, sizeof(image_magic)) != 0 || h.format_version != image_format_version ||
+        h.byte_order != image_byte_order) {
+        return std::nullopt;
+    }
+    // Sections must be in order and inside the image
+    if (h.entries_offset != sizeof(h) ||
+        h.entry_count > (image.size() - h.entries_offset) / sizeof(image_entry) ||
+        h.data_offset != h.entries_offset + h.entry_count * sizeof(image_entry) ||
+        h.data_count > (image.size() - h.data_offset) / sizeof(uint64_t) ||
+        h.strings_offset != h.data_offset + h.data_count * sizeof(uint64_t) ||
+        h.strings_size != image.size() - h.strings_offset) {
+        return std::nullopt;
+    }
+
+    image_reader r(image, h);
+    if (r.string_at(h.version_offset, h.version_size) != kEnumbraVersion) {
+        return std::nullopt;
+    }
+
+    compiled_schema schema;
+
+    // Config
+    auto &cpp = schema.config.cpp_config;
+    schema.config.generate_cpp = r.boolean();
+    schema.config.generate_csharp = r.boolean();
+    cpp.output_namespace = r.strings();
+    cpp.preamble_text = r.strings();
+    cpp.additional_includes = r.strings();
+    cpp.time_generated_in_header = r.boolean();
+    cpp.size_types.resize(r.count());
+    for (auto &t: cpp.size_types) {
+        t.name = r.string();
+        t.bits = static_cast<int32_t>(static_cast<int64_t>(r.word()));
+        t.is_signed = r.boolean();
+        t.type_name = r.string();
+        t.min_possible_value = r.int128_value();
+        t.max_possible_value = r.int128_value();
+    }
+    cpp.default_value_enum_size_type_index = static_cast<size_t>(r.word());
+    cpp.default_flags_enum_size_type_index = static_cast<size_t>(r.word());
+    cpp.string_table_layout = static_cast<cpp::StringTableLayout>(r.word());
+    cpp.simd_codegen = static_cast<cpp::SIMDCodeGen>(r.word());
+    cpp.min_max_functions = r.boolean();
+    cpp.bit_info_functions = r.boolean();
+    cpp.enumbra_bitfield_macros = r.boolean();
+
+    // Schema
+    auto &meta = schema.meta;
+    meta.value_enum_default_value_style = static_cast<ValueEnumDefaultValueStyle>(r.word());
+    meta.flags_enum_default_value_style = static_cast<FlagsEnumDefaultValueStyle>(r.word());
+    meta.value_enum_definitions.resize(r.count());
+    schema.validation.value_enums.resize(meta.value_enum_definitions.size());
+    for (size_t i = 0; i < meta.value_enum_definitions.size() && !r.failed(); i++) {
+        read_enum(r, meta.value_enum_definitions[i], schema.validation.value_enums[i]);
+    }
+    meta.flag_enum_definitions.resize(r.count());
+    schema.validation.flags_enums.resize(meta.flag_enum_definitions.size());
+    for (size_t i = 0; i < meta.flag_enum_definitions.size() && !r.failed(); i++) {
+        read_enum(r, meta.flag_enum_definitions[i], schema.validation.flags_enums[i]);
+    }
+
+    if (r.failed() || !r.at_end()) {
+        return std::nullopt;
+    }
+    return schema;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "enumbra.h"
+#include "cpp_generator.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+// A loaded config and schema together with the validation results of the schema
+struct compiled_schema {
+    enumbra::enumbra_config config;
+    enumbra::enum_meta_config meta;
+    schema_validation validation;
+};
+
+// Validates a loaded schema, throws like cpp_generator for invalid schemas
+compiled_schema compile_schema(enumbra::enumbra_config config, enumbra::enum_meta_config meta, unsigned int jobs = 1);
+
+// Binary image of a compiled schema, read back without parsing JSON or validating again.
+// Layout, all integers in native byte order:
+//   header   magic, format version, byte order mark, enumbra version and the offset/size of each section
+//   entries  fixed-size records of all enum entries, each enum references a range
+//   data     64-bit words: the config, then each enum with its definition, entry range and validation results
+//   strings  pool that every string of the other sections points into
+// Must be updated, and image_format_version bumped, when fields are added to the config or enum definitions.
+std::string write_schema_image(const compiled_schema &schema);
+
+// Returns nullopt for images of another format version, enumbra version or byte order, and for corrupt images
+std::optional<compiled_schema> read_schema_image(std::string_view image);
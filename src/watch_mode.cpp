@@ -0,0 +1,272 @@
+#include "watch_mode.h"
+
+#include "config_loader.h"
+#include "generation_cache.h"
+
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace enumbra;
+
+namespace {
+    // Protocol lines must stay on one line
+    std::string single_line(std::string str) {
+        for (auto &c: str) {
+            if (c == '\n' || c == '\r') {
+                c = ' ';
+            }
+        }
+        return str;
+    }
+
+    std::string read_file_or_empty(const std::string &path) {
+        try {
+            return read_file_bytes(path);
+        } catch (const std::exception &) {
+            return {};
+        }
+    }
+
+    class watch_session {
+    public:
+        watch_session(const std::string &config_file, const std::vector<generation_job> &jobs, const generation_options &options)
+            : config_file_(config_file), options_(options) {
+            // Generation runs on a single thread at a time, the job count only applies within a schema
+            options_.print = false;
+            for (const auto &job: jobs) {
+                jobs_.push_back({job, {}, false, std::make_unique<fragment_cache>()});
+            }
+        }
+
+        [[nodiscard]] const std::string &config_file() const { return config_file_; }
+        [[nodiscard]] std::vector<std::string> sources() const {
+            std::vector<std::string> sources;
+            for (const auto &j: jobs_) {
+                sources.push_back(j.job.source);
+            }
+            return sources;
+        }
+
+        // Regenerates jobs whose inputs changed. With a source only the jobs of that source are regenerated, unconditionally.
+        void generate(const std::string &source, bool report_unchanged) {
+            const bool config_changed = reload_config();
+            for (auto &j: jobs_) {
+                const bool forced = !source.empty();
+                if (forced && !same_file(j.job.source, source)) {
+                    continue;
+                }
+                generate_job(j, forced || config_changed, report_unchanged);
+            }
+        }
+
+        // Handles one protocol line, returns false when the session should end
+        bool handle_request(const std::string &line) {
+            const auto first_space = line.find(' ');
+            const std::string command = line.substr(0, first_space);
+            const std::string argument = (first_space == std::string::npos) ? "" : line.substr(first_space + 1);
+            if (command == "quit") {
+                return false;
+            }
+            if (command == "generate") {
+                generate(argument, true);
+            } else if (!command.empty()) {
+                printf("error %s unknown request\n", single_line(command).c_str());
+            }
+            printf("done\n");
+            fflush(stdout);
+            return true;
+        }
+
+    private:
+        struct watched_job {
+            generation_job job;
+            std::string source_bytes; // Schema the outputs were last generated from
+            bool generated = false;
+            std::unique_ptr<fragment_cache> fragments; // Code of the enums as they were last generated
+        };
+
+        std::string config_file_;
+        std::string config_bytes_;
+        std::string config_fingerprint_;
+        std::optional<enumbra_config> config_;
+        generation_options options_;
+        std::vector<watched_job> jobs_;
+
+        static bool same_file(const std::string &a, const std::string &b) {
+            std::error_code ec;
+            return std::filesystem::equivalent(a, b, ec) || a == b;
+        }
+
+        // Returns true if the config changed and was loaded successfully
+        bool reload_config() {
+            std::string bytes = read_file_or_empty(config_file_);
+            if (config_ && bytes == config_bytes_) {
+                return false;
+            }
+            try {
+                config_ = parse_enumbra_config_text(bytes);
+                config_fingerprint_ = config_fingerprint(bytes);
+                config_bytes_ = std::move(bytes);
+                if (options_.shared_base) {
+                    write_shared_base(*config_, *options_.shared_base);
+                }
+                return true;
+            } catch (const std::exception &e) {
+                // Keep using the previous config until the file is fixed
+                printf("error %s %s\n", config_file_.c_str(), single_line(e.what()).c_str());
+                return false;
+            }
+        }
+
+        // With a cache directory, a schema that was compiled before (e.g. reverted edits or other sessions) is loaded from its image
+        compiled_schema compile_job_schema(const std::string &bytes) const {
+            if (!options_.cache_dir) {
+                return compile_schema(*config_, parse_meta_config_text(*config_, bytes), options_.jobs);
+            }
+            const generation_cache cache(*options_.cache_dir, options_.cache_max_bytes);
+            const std::string key = generation_cache::make_key(config_bytes_, bytes, "schema-image");
+            if (auto schema = cache.load_schema(key)) {
+                return std::move(*schema);
+            }
+            compiled_schema schema = compile_schema(*config_, parse_meta_config_text(*config_, bytes), options_.jobs);
+            cache.store_schema(key, schema);
+            return schema;
+        }
+
+        void generate_job(watched_job &j, bool force, bool report_unchanged) {
+            if (!config_) {
+                return;
+            }
+            std::string bytes = read_file_or_empty(j.job.source);
+            if (!force && j.generated && bytes == j.source_bytes) {
+                if (report_unchanged) {
+                    printf("unchanged %s\n", j.job.source.c_str());
+                }
+                return;
+            }
+            try {
+                const compiled_schema schema = compile_job_schema(bytes);
+                const auto files = generate_job_files(schema.config, schema.meta, j.job, options_.jobs, j.fragments.get(),
+                                                      config_fingerprint_, &schema.validation);
+                const auto result = write_job_files(j.job, files, false);
+                j.fragments->retain_used();
+                j.source_bytes = std::move(bytes);
+                j.generated = true;
+                printf("ok %s %zu %zu\n", j.job.source.c_str(), result.files_written, result.files_total);
+            } catch (const std::exception &e) {
+                printf("error %s %s\n", j.job.source.c_str(), single_line(e.what()).c_str());
+            }
+        }
+    };
+}
+
+int run_watch(const std::string &config_file, const std::vector<generation_job> &jobs, const generation_options &options) {
+    watch_session session(config_file, jobs, options);
+    session.generate("", false);
+    printf("done\n");
+    fflush(stdout);
+
+#if defined(__linux__)
+    const int inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0) {
+        throw std::runtime_error("inotify_init1 failed");
+    }
+
+    // Watch directories rather than files, editors often replace a file by renaming a new one over it
+    std::map<int, std::filesystem::path> watched_dirs;
+    std::vector<std::string> inputs = session.sources();
+    inputs.push_back(session.config_file());
+    for (const auto &input: inputs) {
+        const auto dir = std::filesystem::absolute(input).parent_path();
+        const int wd = inotify_add_watch(inotify_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (wd < 0) {
+            close(inotify_fd);
+            throw std::runtime_error("Failed to watch directory: " + dir.string());
+        }
+        watched_dirs[wd] = dir;
+    }
+    const auto is_input = [&](const std::filesystem::path &path) {
+        for (const auto &input: inputs) {
+            if (std::filesystem::absolute(input).lexically_normal() == path.lexically_normal()) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::string stdin_buffer;
+    bool pending_change = false;
+    bool running = true;
+    while (running) {
+        pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {inotify_fd, POLLIN, 0}};
+        // Wait for events to settle before regenerating, a save can produce several
+        const int ready = poll(fds, 2, pending_change ? 50 : -1);
+        if (ready < 0) {
+            continue; // EINTR
+        }
+        if (ready == 0 && pending_change) {
+            pending_change = false;
+            session.generate("", false);
+            fflush(stdout);
+            continue;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            alignas(inotify_event) char buffer[4096];
+            ssize_t length;
+            while ((length = read(inotify_fd, buffer, sizeof(buffer))) > 0) {
+                for (char *p = buffer; p < buffer + length;) {
+                    const auto *event = reinterpret_cast<const inotify_event *>(p);
+                    if (event->len > 0 && is_input(watched_dirs[event->wd] / event->name)) {
+                        pending_change = true;
+                    }
+                    p += sizeof(inotify_event) + event->len;
+                }
+            }
+        }
+
+        if (fds[0].revents & (POLLIN | POLLHUP)) {
+            char buffer[4096];
+            const ssize_t length = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break; // stdin closed
+            }
+            stdin_buffer.append(buffer, static_cast<size_t>(length));
+            size_t newline;
+            while (running && (newline = stdin_buffer.find('\n')) != std::string::npos) {
+                std::string line = stdin_buffer.substr(0, newline);
+                stdin_buffer.erase(0, newline + 1);
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                running = session.handle_request(line);
+            }
+        }
+    }
+
+    close(inotify_fd);
+#else
+    // Without inotify, changes are only picked up by requests
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!session.handle_request(line)) {
+            break;
+        }
+    }
+#endif
+
+    return 0;
+}
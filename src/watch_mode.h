@@ -0,0 +1,20 @@
+#pragma once
+
+#include "generation_job.h"
+
+#include <string>
+#include <vector>
+
+// Keeps the config and schemas loaded and regenerates outputs when their inputs change.
+//
+// On Linux the config and schema files are watched with inotify. Requests are also read from stdin, one per line:
+//   generate            Regenerate every job whose config or schema changed since it was last generated
+//   generate <source>   Regenerate the job(s) of a schema, even if it didn't change
+//   quit                Exit, same as closing stdin
+// Each regenerated job prints one line to stdout, followed by "done" after a request:
+//   ok <source> <files written> <files total>
+//   unchanged <source>
+//   error <source> <message>
+// Outputs are written with the same skip-unchanged semantics as a normal run.
+// Returns the process exit code.
+int run_watch(const std::string &config_file, const std::vector<generation_job> &jobs, const generation_options &options);
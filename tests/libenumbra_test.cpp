@@ -0,0 +1,101 @@
+// Checks that the in-memory libenumbra API generates the same header as the enumbra executable, and that invalid
+// input is reported as diagnostics. Usage: enumbra_libenumbra_test <enumbra_config.json> <enum.json> <header>
+// where header was generated by enumbra from the same config and schema.
+
+#include "libenumbra.h"
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const std::string &message) {
+        if (!condition) {
+            std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+            failures++;
+        }
+    }
+
+    std::string read_file(const char *path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            check(false, std::string("can't read ") + path);
+            return {};
+        }
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void check_header(const libenumbra::generate_result &result, const std::string &expected, const std::string &what) {
+        check(result.success, what + ": generation failed");
+        for (const auto &d: result.diagnostics) {
+            check(false, what + ": unexpected diagnostic: " + d.stage + ": " + d.message);
+        }
+        check(result.files.size() == 1 && result.files[0].name.empty(), what + ": expected a single header");
+        check(!result.files.empty() && result.files[0].content == expected, what + ": header differs from the enumbra output");
+    }
+
+    // Invalid input must fail with a diagnostic of stage, not throw
+    void check_rejected(std::string_view config_json, std::string_view schema_json, const char *stage, const std::string &what) {
+        try {
+            const libenumbra::generate_result result = libenumbra::generate(config_json, schema_json);
+            check(!result.success && result.files.empty(), what + ": invalid input was generated");
+            check(!result.diagnostics.empty() && result.diagnostics[0].stage == stage && !result.diagnostics[0].message.empty(),
+                  what + ": expected a diagnostic of stage " + stage);
+        } catch (const std::exception &e) {
+            check(false, what + ": threw " + e.what());
+        }
+    }
+
+    constexpr const char *duplicate_entries_schema = R"({
+  "enums": {
+    "value_enum_default_value_style": "min",
+    "flags_enum_default_value_style": "zero",
+    "value_enums": [
+      { "name": "Color", "entries": [ { "name": "Red", "value": 1 }, { "name": "Red", "value": 2 } ] }
+    ],
+    "flags_enums": []
+  }
+})";
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        std::fprintf(stderr, "Usage: %s <enumbra_config.json> <enum.json> <header>\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        const std::string config_json = read_file(argv[1]);
+        const std::string schema_json = read_file(argv[2]);
+        const std::string expected = read_file(argv[3]);
+
+        check_header(libenumbra::generate(config_json, schema_json), expected, "generate(config_json, schema_json)");
+
+        // Loaded once and generated on several threads, the output doesn't depend on the thread count
+        const libenumbra::config_result cfg = libenumbra::load_config(config_json);
+        check(cfg.value != nullptr, "load_config failed");
+        if (cfg.value) {
+            const libenumbra::schema_result s = libenumbra::load_schema(*cfg.value, schema_json, 4);
+            check(s.value != nullptr, "load_schema failed");
+            if (s.value) {
+                libenumbra::generate_options options;
+                options.jobs = 4;
+                check_header(libenumbra::generate(*cfg.value, *s.value, options), expected, "generate(cfg, schema) with 4 jobs");
+            }
+        }
+
+        check_rejected(config_json, "{ \"enums\": ", "schema", "truncated schema");
+        check_rejected(config_json, duplicate_entries_schema, "schema", "schema with duplicate entries");
+        check_rejected("[]", schema_json, "config", "invalid config");
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "FAILED: %s\n", e.what());
+        return 1;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
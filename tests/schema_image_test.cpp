@@ -0,0 +1,131 @@
+// Checks that a schema image reads back the schema it was written from, and that damaged or outdated images are
+// rejected. Usage: enumbra_schema_image_test <enumbra_config.json> <enum.json>
+
+#include "config_loader.h"
+#include "schema_image.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace enumbra;
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const std::string &message) {
+        if (!condition) {
+            std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+            failures++;
+        }
+    }
+
+    bool relations_equal(const std::vector<flags_relation> &lhs, const std::vector<flags_relation> &rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); i++) {
+            if (lhs[i].flag != rhs[i].flag || lhs[i].targets != rhs[i].targets) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool presets_equal(const std::vector<flags_preset> &lhs, const std::vector<flags_preset> &rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); i++) {
+            if (lhs[i].name != rhs[i].name || lhs[i].flags != rhs[i].flags) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void check_definitions(const std::vector<enum_definition> &expected, const std::vector<enum_definition> &actual) {
+        check(expected.size() == actual.size(), "enum count differs");
+        for (size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+            const enum_definition &e = expected[i];
+            const enum_definition &a = actual[i];
+            check(e.name == a.name, "name differs: " + e.name);
+            check(e.values == a.values, "entries differ: " + e.name);
+            check(e.default_value_name == a.default_value_name, "default value differs: " + e.name);
+            check(e.constraints.exclusive == a.constraints.exclusive, "exclusive constraints differ: " + e.name);
+            check(e.constraints.exactly_one == a.constraints.exactly_one, "exactly_one constraints differ: " + e.name);
+            check(relations_equal(e.constraints.requirements, a.constraints.requirements), "requires constraints differ: " + e.name);
+            check(relations_equal(e.constraints.implications, a.constraints.implications), "implies constraints differ: " + e.name);
+            check(presets_equal(e.presets, a.presets), "presets differ: " + e.name);
+            check(e.to_string_presets == a.to_string_presets, "to_string_presets differs: " + e.name);
+            check(e.group == a.group, "group differs: " + e.name);
+            check(e.out_of_line == a.out_of_line, "out_of_line differs: " + e.name);
+            check(e.size_type_index == a.size_type_index, "size type differs: " + e.name);
+        }
+    }
+
+    void check_validations(const std::vector<enum_validation> &expected, const std::vector<enum_validation> &actual) {
+        check(expected.size() == actual.size(), "validation count differs");
+        for (size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+            const std::string index = std::to_string(i);
+            check(expected[i].unique_entry_count == actual[i].unique_entry_count, "unique entry count differs: " + index);
+            check(expected[i].is_contiguous == actual[i].is_contiguous, "is_contiguous differs: " + index);
+            check(expected[i].has_zero == actual[i].has_zero, "has_zero differs: " + index);
+            check(expected[i].has_minus_one == actual[i].has_minus_one, "has_minus_one differs: " + index);
+            check(expected[i].has_all_bits == actual[i].has_all_bits, "has_all_bits differs: " + index);
+        }
+    }
+
+    // The config has no comparison, a header generated from it covers everything the output depends on
+    std::string generate_header(const compiled_schema &schema) {
+        cpp_generator cpp_gen(schema.config, schema.meta);
+        cpp_gen.set_validation(&schema.validation);
+        return cpp_gen.generate_cpp_output();
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: %s <enumbra_config.json> <enum.json>\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        const enumbra_config config = load_enumbra_config(argv[1]);
+        const compiled_schema schema = compile_schema(config, load_meta_config(config, argv[2]));
+        const std::string image = write_schema_image(schema);
+
+        const std::optional<compiled_schema> read = read_schema_image(image);
+        check(read.has_value(), "image was not read back");
+        if (read) {
+            check(schema.meta.value_enum_default_value_style == read->meta.value_enum_default_value_style, "value enum default style differs");
+            check(schema.meta.flags_enum_default_value_style == read->meta.flags_enum_default_value_style, "flags enum default style differs");
+            check_definitions(schema.meta.value_enum_definitions, read->meta.value_enum_definitions);
+            check_definitions(schema.meta.flag_enum_definitions, read->meta.flag_enum_definitions);
+            check_validations(schema.validation.value_enums, read->validation.value_enums);
+            check_validations(schema.validation.flags_enums, read->validation.flags_enums);
+            check(generate_header(schema) == generate_header(*read), "headers generated from the schema and its image differ");
+            check(write_schema_image(*read) == image, "image of the read schema differs");
+        }
+
+        // Every truncation, including an empty image and one with only part of the header
+        for (size_t size = 0; size < image.size(); size += (size < 256 ? 1 : 97)) {
+            check(!read_schema_image(std::string_view(image).substr(0, size)), "truncated image was read, size " + std::to_string(size));
+        }
+        check(!read_schema_image(std::string_view(image).substr(0, image.size() - 1)), "image without its last byte was read");
+
+        // The format version follows the 8-byte magic
+        std::string bumped = image;
+        uint32_t format_version = 0;
+        std::memcpy(&format_version, bumped.data() + 8, sizeof(format_version));
+        format_version++;
+        std::memcpy(bumped.data() + 8, &format_version, sizeof(format_version));
+        check(!read_schema_image(bumped), "image with another format version was read");
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "FAILED: %s\n", e.what());
+        return 1;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
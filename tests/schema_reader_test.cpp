@@ -0,0 +1,93 @@
+// Checks that the streamed schema reader (parse_meta_config_text) and the document path (parse_meta_config)
+// read the same enums. Usage: enumbra_schema_reader_test <enumbra_config.json>
+
+#include "config_loader.h"
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+using namespace enumbra;
+
+namespace {
+    // Entries with numeric keys that aren't "value", before and after it, must not change the value
+    constexpr const char *schema_text = R"({
+  "enums": {
+    "value_enum_default_value_style": "min",
+    "flags_enum_default_value_style": "zero",
+    "value_enums": [
+      {
+        "name": "Color",
+        "size_type": "signed32",
+        "entries": [
+          { "name": "Red", "value": 5, "since": 9 },
+          { "name": "Blue", "value": -2, "since": -7 },
+          { "since": 11, "name": "Green", "value": 7 },
+          { "since": -3, "value": 8, "name": "Cyan", "until": 12 },
+          { "name": "Magenta", "revision": 4 }
+        ]
+      }
+    ],
+    "flags_enums": [
+      {
+        "name": "Access",
+        "entries": [
+          { "name": "Read", "value": 1, "bit": 6 },
+          { "bit": 5, "name": "Write", "value": 2 }
+        ]
+      }
+    ]
+  }
+})";
+
+    int failures = 0;
+
+    void check(bool condition, const std::string &message) {
+        if (!condition) {
+            std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+            failures++;
+        }
+    }
+
+    // Entries are sorted by value when loaded, expected values are looked up by name
+    void check_values(const enum_definition &e, const std::map<std::string, int64_t> &expected, const char *path) {
+        check(e.values.size() == expected.size(), std::string(path) + ": entry count of " + e.name);
+        for (const auto &v: e.values) {
+            const auto it = expected.find(v.name);
+            check(it != expected.end() && v.p_value == it->second, std::string(path) + ": value of " + e.name + "::" + v.name);
+        }
+    }
+
+    void check_equal(const std::vector<enum_definition> &streamed, const std::vector<enum_definition> &document) {
+        check(streamed.size() == document.size(), "enum count differs");
+        for (size_t i = 0; i < streamed.size() && i < document.size(); i++) {
+            check(streamed[i].name == document[i].name, "enum name differs: " + streamed[i].name);
+            check(streamed[i].values == document[i].values, "entries differ: " + streamed[i].name);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: %s <enumbra_config.json>\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        const enumbra_config config = load_enumbra_config(argv[1]);
+        const enum_meta_config streamed = parse_meta_config_text(config, schema_text);
+        const enum_meta_config document = parse_meta_config(config, json::parse(schema_text));
+
+        check_values(streamed.value_enum_definitions.at(0), {{"Red", 5}, {"Blue", -2}, {"Green", 7}, {"Cyan", 8}, {"Magenta", 9}}, "streamed");
+        check_values(document.value_enum_definitions.at(0), {{"Red", 5}, {"Blue", -2}, {"Green", 7}, {"Cyan", 8}, {"Magenta", 9}}, "document");
+        check_values(streamed.flag_enum_definitions.at(0), {{"Read", 1}, {"Write", 2}}, "streamed");
+        check_values(document.flag_enum_definitions.at(0), {{"Read", 1}, {"Write", 2}}, "document");
+        check_equal(streamed.value_enum_definitions, document.value_enum_definitions);
+        check_equal(streamed.flag_enum_definitions, document.flag_enum_definitions);
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "FAILED: %s\n", e.what());
+        return 1;
+    }
+
+    return failures == 0 ? 0 : 1;
+}